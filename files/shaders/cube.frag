@@ -4,8 +4,8 @@ out vec4 FragColor;
 
 struct Material
 {
-	sampler2D diffuse;
-	sampler2D specular;
+	sampler2DArray diffuse;
+	sampler2DArray specular;
 	float shininess;
 };
 
@@ -22,7 +22,7 @@ struct PointLight
 {
 	vec3 position;
 	float intensity;
-	float distance;
+	float radius; //no light reaches further
 	
 	float constant;
 	float linear;
@@ -33,32 +33,94 @@ struct PointLight
 	vec3 specular;
 };
 
-#define NR_POINT_LIGHTS 4
+//must match the cluster grid in lightclusters.hpp
+#define CLUSTERS_X 16
+#define CLUSTERS_Y 9
+#define CLUSTERS_Z 24
+
+//RGBA32F texels of one light in clusterLights
+#define LIGHT_TEXELS 5
 
 in vec3 FragPos;
 in vec3 Normal;
-in vec2 TexCoords;
+in vec3 TexCoords;
+in vec4 Color;
+
+//shared by every program, uploaded once per frame
+layout(std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec4 position;
+	vec4 viewSize;
+} camera;
+
+layout(std140) uniform Lights
+{
+	DirLight dirLight;
+	vec4 clusterDepth; //near and far plane, slices per log unit of depth, 0 in w turns point lights off
+} lights;
 
-uniform vec3 viewPos;
-uniform DirLight dirLight;
-uniform PointLight pointLights[NR_POINT_LIGHTS];
 uniform Material material;
 
+//every point light of the frame, then the first index and count of each cluster,
+//then the light indices of every cluster back to back
+uniform samplerBuffer clusterLights;
+uniform usamplerBuffer clusterRanges;
+uniform usamplerBuffer clusterIndices;
+
+PointLight FetchPointLight(int index);
+
 vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir);
 vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir);
 
 void main()
 {
 	vec3 norm = normalize(Normal);
-	vec3 viewDir = normalize(viewPos - FragPos);
+	vec3 viewDir = normalize(camera.position.xyz - FragPos);
 	
-	vec3 result = CalcDirLight(dirLight, norm, viewDir);
-	for (int i = 0; i < NR_POINT_LIGHTS; i++)
+	vec3 result = CalcDirLight(lights.dirLight, norm, viewDir);
+	
+	if (lights.clusterDepth.w != 0.0)
 	{
-		result += CalcPointLight(pointLights[i], norm, FragPos, viewDir);
+		//screen tile from the pixel, exponential depth slice from the view depth
+		float depth = -(camera.view * vec4(FragPos, 1.0)).z;
+		ivec2 tile = ivec2(gl_FragCoord.xy * camera.viewSize.zw * vec2(CLUSTERS_X, CLUSTERS_Y));
+		int slice = int(log(depth / lights.clusterDepth.x) * lights.clusterDepth.z);
+		
+		tile = clamp(tile, ivec2(0), ivec2(CLUSTERS_X - 1, CLUSTERS_Y - 1));
+		slice = clamp(slice, 0, CLUSTERS_Z - 1);
+		
+		int cluster = (slice * CLUSTERS_Y + tile.y) * CLUSTERS_X + tile.x;
+		uvec2 range = texelFetch(clusterRanges, cluster).xy;
+		for (uint i = 0u; i < range.y; i++)
+		{
+			int index = int(texelFetch(clusterIndices, int(range.x + i)).r);
+			result += CalcPointLight(FetchPointLight(index), norm, FragPos, viewDir);
+		}
 	}
 	
-	FragColor = vec4(result, 1.0);
+	FragColor = vec4(result, 1.0) * Color;
+}
+
+PointLight FetchPointLight(int index)
+{
+	int first = index * LIGHT_TEXELS;
+	vec4 positionRadius = texelFetch(clusterLights, first);
+	vec4 falloff = texelFetch(clusterLights, first + 1);
+	
+	PointLight light;
+	light.position = positionRadius.xyz;
+	light.radius = positionRadius.w;
+	light.intensity = falloff.x;
+	light.constant = falloff.y;
+	light.linear = falloff.z;
+	light.quadratic = falloff.w;
+	light.ambient = texelFetch(clusterLights, first + 2).rgb;
+	light.diffuse = texelFetch(clusterLights, first + 3).rgb;
+	light.specular = texelFetch(clusterLights, first + 4).rgb;
+	
+	return light;
 }
 
 vec3 CalcDirLight(DirLight light, vec3 normal, vec3 viewDir)
@@ -95,10 +157,14 @@ vec3 CalcPointLight(PointLight light, vec3 normal, vec3 fragPos, vec3 viewDir)
 	float spec = pow(max(dot(viewDir, reflectDir), 0.0), material.shininess);
 	
 	//attenuation
-	float distance = length(light.position - fragPos);
-	distance /= light.distance;
+	float distance = length(light.position - fragPos) / light.radius;
 	float attenuation = 1.0 / (light.constant + light.linear * distance + light.quadratic * (distance * distance));
 	
+	//fades to zero at the radius, so dropping the light outside its clusters leaves no seam
+	float distance2 = distance * distance;
+	float window = clamp(1.0 - distance2 * distance2, 0.0, 1.0);
+	attenuation *= window * window;
+	
 	//combine results
 	vec3 ambient = light.ambient * vec3(texture(material.diffuse, TexCoords));
 	vec3 diffuse = light.diffuse * diff * vec3(texture(material.diffuse, TexCoords));
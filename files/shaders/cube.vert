@@ -4,19 +4,55 @@ layout(location = 0) in vec3 aPos;
 layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aTexCoords;
 
+//per instance
+layout(location = 3) in mat4 aModel;
+layout(location = 7) in vec4 aColor;
+layout(location = 8) in vec4 aUVRect; //texture region offset in xy, scale in zw
+layout(location = 9) in float aLayer;
+layout(location = 10) in uint aNet; //0xFFFFFFFF for instances without a net
+
 out vec3 FragPos;
 out vec3 Normal;
-out vec2 TexCoords;
+out vec3 TexCoords; //uv inside the texture array, layer in z
+out vec4 Color;
+
+//shared by every program, uploaded once per frame
+layout(std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec4 position;
+	vec4 viewSize;
+} camera;
 
-uniform mat4 model;
-uniform mat4 view;
-uniform mat4 projection;
+//one bit per net, net n is bit n % 32 of texel n / 32
+uniform usamplerBuffer netStates;
+
+//brightness of an instance whose net is low
+const float LOW_NET_BRIGHTNESS = 0.35;
 
 void main()
 {
-	FragPos = vec3(model * vec4(aPos, 1.0));
-	Normal = mat3(transpose(inverse(model))) * aNormal;
-	TexCoords = aTexCoords;
+	FragPos = vec3(aModel * vec4(aPos, 1.0));
+	
+	//normals need the inverse transpose once instances scale non-uniformly. The cofactor matrix is
+	//that times the determinant and needs no inverse(), the fragment shader normalizes the length
+	//and only the sign has to be undone for mirrored instances.
+	mat3 model = mat3(aModel);
+	mat3 cofactor = mat3(
+		cross(model[1], model[2]),
+		cross(model[2], model[0]),
+		cross(model[0], model[1]));
+	float determinant = dot(model[0], cofactor[0]);
+	Normal = cofactor * aNormal * (determinant < 0.0 ? -1.0 : 1.0);
+	TexCoords = vec3(aUVRect.xy + aTexCoords * aUVRect.zw, aLayer);
+	Color = aColor;
+	if (aNet != 0xFFFFFFFFu)
+	{
+		uint word = texelFetch(netStates, int(aNet >> 5u)).r;
+		bool isHigh = ((word >> (aNet & 31u)) & 1u) != 0u;
+		Color.rgb *= isHigh ? 1.0 : LOW_NET_BRIGHTNESS;
+	}
 	
-	gl_Position = projection * view * vec4(FragPos, 1.0);
+	gl_Position = camera.projection * camera.view * vec4(FragPos, 1.0);
 }
\ No newline at end of file
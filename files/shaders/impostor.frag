@@ -0,0 +1,17 @@
+#version 330 core
+
+out vec4 FragColor;
+
+in vec3 TexCoords;
+
+uniform sampler2DArray impostors;
+
+void main()
+{
+	vec4 texel = texture(impostors, TexCoords);
+	
+	//empty board between the gates was cleared to transparent black,
+	//mipmaps blend it into the edges, so the color is divided back out
+	if (texel.a < 0.5) discard;
+	FragColor = vec4(texel.rgb / texel.a, 1.0);
+}
\ No newline at end of file
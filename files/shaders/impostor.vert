@@ -0,0 +1,29 @@
+#version 330 core
+
+layout(location = 0) in vec2 aCorner; //0 to 1 across the quad
+
+//per chunk
+layout(location = 1) in vec4 aRect; //board plane min in xy, max in zw
+layout(location = 2) in float aLayer;
+
+out vec3 TexCoords; //uv inside the impostor array, layer in z
+
+//shared by every program, uploaded once per frame
+layout(std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec4 position;
+	vec4 viewSize;
+} camera;
+
+//the impostors were rendered looking down at the gate tops
+const float HEIGHT = 0.5;
+
+void main()
+{
+	vec2 position = mix(aRect.xy, aRect.zw, aCorner);
+	TexCoords = vec3(aCorner, aLayer);
+	
+	gl_Position = camera.projection * camera.view * vec4(position, HEIGHT, 1.0);
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#version 330 core
+
+layout(location = 0) in vec2 aPos;
+layout(location = 1) in vec4 aColor;
+
+out vec4 Color;
+
+//shared by every program, uploaded once per frame
+layout(std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec4 position;
+	vec4 viewSize; //pixels in xy, their reciprocals in zw
+} camera;
+
+void main()
+{
+	//pixel coordinates with the origin at the top left corner of the window
+	vec2 ndc = vec2(
+		aPos.x * camera.viewSize.z * 2.0 - 1.0,
+		1.0 - aPos.y * camera.viewSize.w * 2.0);
+	
+	Color = aColor;
+	gl_Position = vec4(ndc, 0.0, 1.0);
+}
\ No newline at end of file
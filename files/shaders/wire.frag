@@ -0,0 +1,10 @@
+#version 330 core
+
+out vec4 FragColor;
+
+flat in vec4 Color;
+
+void main()
+{
+	FragColor = Color;
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#version 330 core
+
+layout(location = 0) in vec2 aCorner; //0 at the start and 1 at the end in x, side of the line in y
+
+//per segment
+layout(location = 1) in vec4 aSegment; //start in xy, end in zw, world units
+layout(location = 2) in uint aNet;     //0xFFFFFFFF for wires without a net
+
+flat out vec4 Color;
+
+//shared by every program, uploaded once per frame
+layout(std140) uniform Camera
+{
+	mat4 view;
+	mat4 projection;
+	vec4 position;
+	vec4 viewSize; //pixels in xy, their reciprocals in zw
+} camera;
+
+//one bit per net, net n is bit n % 32 of texel n / 32
+uniform usamplerBuffer netStates;
+
+uniform float height;    //world z of the board plane the wires lie on
+uniform float lineWidth; //pixels
+
+const vec4 HIGH_COLOR = vec4(0.35, 0.95, 0.45, 1.0);
+const vec4 LOW_COLOR = vec4(0.12, 0.32, 0.16, 1.0);
+const vec4 NO_NET_COLOR = vec4(0.5, 0.5, 0.5, 1.0);
+
+void main()
+{
+	mat4 viewProjection = camera.projection * camera.view;
+	vec4 start = viewProjection * vec4(aSegment.xy, height, 1.0);
+	vec4 end = viewProjection * vec4(aSegment.zw, height, 1.0);
+	
+	//the quad is widened in pixels, so the line keeps its width at every zoom level
+	vec2 startPixels = start.xy / start.w * camera.viewSize.xy;
+	vec2 endPixels = end.xy / end.w * camera.viewSize.xy;
+	vec2 direction = endPixels - startPixels;
+	float pixelLength = length(direction);
+	direction = pixelLength > 0.0001 ? direction / pixelLength : vec2(1.0, 0.0);
+	vec2 normal = vec2(-direction.y, direction.x);
+	
+	//square caps, so the pieces of a wire meet without gaps at corners and chunk borders
+	vec2 offset = (normal * aCorner.y + direction * (aCorner.x * 2.0 - 1.0)) * lineWidth * 0.5;
+	
+	vec4 position = mix(start, end, aCorner.x);
+	position.xy += offset * camera.viewSize.zw * 2.0 * position.w;
+	gl_Position = position;
+	
+	if (aNet == 0xFFFFFFFFu) Color = NO_NET_COLOR;
+	else
+	{
+		uint word = texelFetch(netStates, int(aNet >> 5u)).r;
+		bool isHigh = ((word >> (aNet & 31u)) & 1u) != 0u;
+		Color = isHigh ? HIGH_COLOR : LOW_COLOR;
+	}
+}
\ No newline at end of file
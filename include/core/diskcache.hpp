@@ -0,0 +1,73 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/mappedfile.hpp"
+
+namespace CircuitGame::Core
+{
+	using std::size_t;
+	using std::uint64_t;
+	using std::unique_ptr;
+	using std::string;
+	using std::vector;
+
+	//One piece of a blob, written in order
+	struct BlobPart
+	{
+		const void* data;
+		size_t size;
+	};
+
+	//Directory of blobs named <name>.<key in hex><extension>.
+	//Each name keeps only its newest blob, so a changed key replaces the old one
+	//instead of piling up. Reading and writing are safe from any thread and never log.
+	class DiskCache
+	{
+	public:
+		//Creates the directory, returns false with the reason in error if that fails
+		bool Initialize(
+			const string& directory,
+			const string& extension,
+			string& error);
+
+		bool IsEnabled() const { return isEnabled; }
+
+		//Maps the blob of name and key, nullptr if it does not exist.
+		//A blob that exists but cannot be mapped also returns nullptr and fills error.
+		unique_ptr<MappedFile> Map(
+			const string& name,
+			uint64_t key,
+			string& error) const;
+
+		//Writes the parts to a temporary file and renames it into place, so readers
+		//never see half a blob, then removes the older blobs of name
+		bool Write(
+			const string& name,
+			uint64_t key,
+			const vector<BlobPart>& parts,
+			string& error) const;
+	private:
+		string GetPath(
+			const string& name,
+			uint64_t key) const;
+
+		//True if fileName has exactly the shape of a blob of name, <name>.<16 hex digits><extension>
+		bool IsBlobOf(
+			const string& fileName,
+			const string& name) const;
+
+		string directory{};
+		string extension{};
+		bool isEnabled = false;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+namespace CircuitGame::Core
+{
+	using std::uint64_t;
+	using std::chrono::steady_clock;
+	using std::chrono::time_point;
+	using std::chrono::nanoseconds;
+
+	//Caps the frame rate on an absolute timeline of deadlines. Waits sleep coarsely until
+	//the measured sleep overshoot before the deadline and yield-spin the rest, so the cap holds
+	//to a fraction of a millisecond while a low cap still leaves the core idle most of the frame.
+	class FramePacer
+	{
+	public:
+		//Measures how far sleeps overshoot on this machine, call once at startup.
+		//On Windows this also raises the timer resolution to 1 ms until Shutdown.
+		static void Calibrate();
+
+		//Restores the timer resolution raised by Calibrate
+		static void Shutdown();
+
+		//0 removes the cap
+		static void SetTargetRate(double hz);
+		static double GetTargetRate() { return targetRate; }
+
+		//Waits until the deadline of the frame that was just drawn. Deadlines advance by exactly one
+		//frame time, so sleep errors never accumulate, a frame more than a whole frame late starts
+		//a new timeline instead of rushing the next ones.
+		static void WaitForNextFrame();
+
+		//Waits between iterations that drew nothing, the next drawn frame starts a new timeline
+		static void WaitIdle(nanoseconds idleTime);
+
+		//The next drawn frame starts a new timeline, for callers that waited some other way
+		static void ResetTimeline() { isOnTimeline = false; }
+
+		//Drawn frames that reached their wait after the deadline had already passed
+		static uint64_t GetMissedCount() { return missedCount; }
+		static uint64_t GetPacedCount() { return pacedCount; }
+
+		static nanoseconds GetSleepSlack() { return sleepSlack; }
+	private:
+		//Sleeps until the slack before deadline, then spins
+		static void WaitUntil(time_point<steady_clock> deadline);
+
+		//Learns from one sleep how much it overshot, grows at once and shrinks slowly.
+		//Waits that did not sleep pass zero, so an outlier cannot keep the slack high forever.
+		static void UpdateSlack(nanoseconds overshoot);
+
+		static inline double targetRate{};
+		static inline nanoseconds targetFrameTime{};
+		static inline nanoseconds sleepSlack{};
+		static inline bool hasTimerPeriod = false;
+
+		static inline bool isOnTimeline = false;
+		static inline time_point<steady_clock> deadline{};
+
+		static inline uint64_t missedCount{};
+		static inline uint64_t pacedCount{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace CircuitGame::Core
+{
+	using std::array;
+	using std::size_t;
+	using std::uint64_t;
+	using std::string;
+	using std::chrono::steady_clock;
+	using std::chrono::time_point;
+
+	//Buckets per octave are 2^FRAME_STATS_SUB_BITS, half of them past the first octave,
+	//so a bucket is at most 1 / 64 of its value wide
+	inline constexpr uint64_t FRAME_STATS_SUB_BITS = 7;
+	inline constexpr uint64_t FRAME_STATS_SUB_COUNT = 1 << FRAME_STATS_SUB_BITS;
+
+	//Longest frame time told apart, longer ones land in the last bucket
+	inline constexpr uint64_t FRAME_STATS_MAX_US = 60'000'000;
+
+	//Octaves above the exactly counted range up to FRAME_STATS_MAX_US
+	inline constexpr uint64_t FRAME_STATS_OCTAVES = 20;
+	inline constexpr size_t FRAME_STATS_BUCKETS = FRAME_STATS_SUB_COUNT + FRAME_STATS_OCTAVES * FRAME_STATS_SUB_COUNT / 2;
+
+	static_assert((FRAME_STATS_SUB_COUNT << (FRAME_STATS_OCTAVES - 1)) > FRAME_STATS_MAX_US);
+
+	struct FrameStatsSummary
+	{
+		uint64_t frameCount{};
+		uint64_t hitchCount{};
+		double meanMs{};
+		double p50Ms{};
+		double p95Ms{};
+		double p99Ms{};
+		double maxMs{};
+		double onePercentLowFps{}; //frame rate of the slowest percent of frames
+	};
+
+	//Every presented frame time since startup in a log-bucketed histogram, so percentiles
+	//stay exact to a bucket however long the session runs, at a fixed memory cost.
+	//Only the time between two frames drawn back to back counts, a static board draws nothing
+	//and the gap before the next frame is idle time rather than a slow frame.
+	class FrameStats
+	{
+	public:
+		//Call once per main loop iteration right after rendering
+		static void EndIteration(bool isDrawn);
+
+		//Adds one frame time in microseconds
+		static void Record(uint64_t us);
+
+		static FrameStatsSummary GetSummary();
+
+		//Frame time of the percentile in 0 - 100, the upper end of the bucket it falls in
+		static double GetPercentileMs(double percentile);
+
+		//Writes the summary and every non-empty bucket as basePath.json and basePath.csv,
+		//returns false and fills error if either could not be written
+		static bool Dump(
+			const string& basePath,
+			string& error);
+
+		//One line summary for the log
+		static string ToString();
+
+		static void Reset();
+	private:
+		static size_t GetBucket(uint64_t us);
+
+		//Smallest and largest microsecond value of bucket
+		static uint64_t GetBucketLow(size_t bucket);
+		static uint64_t GetBucketHigh(size_t bucket);
+
+		static inline array<uint64_t, FRAME_STATS_BUCKETS> counts{};
+		static inline uint64_t frameCount{};
+		static inline uint64_t totalUs{};
+		static inline uint64_t maxUs{};
+
+		//a frame counts as a hitch once it takes HITCH_FACTOR times the recent average
+		static inline uint64_t hitchCount{};
+		static inline double averageUs{};
+
+		static inline bool wasDrawn = false;
+		static inline time_point<steady_clock> lastDrawTime{};
+	};
+}
\ No newline at end of file
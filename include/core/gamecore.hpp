@@ -5,24 +5,27 @@
 
 #pragma once
 
-#include <chrono>
+#include <string>
+#include <vector>
 
 namespace CircuitGame::Core
 {
-	using std::chrono::time_point;
-	using std::chrono::steady_clock;
+	using std::string;
+	using std::vector;
 
 	class Game
 	{
 	public:
-		static inline time_point<steady_clock> lastFrameTime{};
-
-		//Initializes all parts of this program
-		static void Initialize();
+		//Initializes all parts of this program. Stress board arguments replace the demo board,
+		//--headless benchmarks the board for --seconds without opening a window.
+		static void Initialize(const vector<string>& arguments);
 
 		//The core program uodate loop
 		static void Update();
 
+		//Stops the simulation and destroys all render data, used on regular exit
+		static void Shutdown();
+
 		//Fully shuts down this program, used when a crash condition is detected
 		static void Shutdown_Crash();
 	};
@@ -0,0 +1,46 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace CircuitGame::Core
+{
+	using std::size_t;
+	using std::uint8_t;
+	using std::uint64_t;
+	using std::string;
+
+	inline constexpr uint64_t HASH_SEED = 0xCBF29CE484222325ull;
+
+	//64-bit FNV-1a, continues from hash so several inputs can be chained into one key.
+	//Used for cache keys, not for anything that needs to resist deliberate collisions.
+	inline uint64_t HashBytes(
+		const void* data,
+		size_t size,
+		uint64_t hash = HASH_SEED)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001B3ull;
+		}
+		return hash;
+	}
+
+	inline uint64_t HashString(
+		const string& value,
+		uint64_t hash = HASH_SEED)
+	{
+		//the length keeps "ab" + "c" and "a" + "bc" apart
+		uint64_t size = value.size();
+		hash = HashBytes(&size, sizeof(size), hash);
+		return HashBytes(value.data(), value.size(), hash);
+	}
+}
\ No newline at end of file
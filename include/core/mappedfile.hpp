@@ -0,0 +1,49 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace CircuitGame::Core
+{
+	using std::size_t;
+	using std::uint8_t;
+	using std::uintptr_t;
+	using std::unique_ptr;
+	using std::string;
+
+	//Read-only view of a whole file mapped into the address space.
+	//Pages are faulted in by the OS on first access, so opening a large
+	//image costs nothing until its bytes are actually read.
+	class MappedFile
+	{
+	public:
+		//Returns nullptr and logs if the file does not exist or cannot be mapped
+		static unique_ptr<MappedFile> Open(const string& filePath);
+
+		//Same as above but never logs, the reason goes into error instead, safe on worker threads
+		static unique_ptr<MappedFile> Open(
+			const string& filePath,
+			string& error);
+
+		const uint8_t* GetData() const { return data; }
+		size_t GetSize() const { return size; }
+		const string& GetPath() const { return path; }
+
+		~MappedFile();
+	private:
+		string path{};
+
+		const uint8_t* data{};
+		size_t size{};
+
+		uintptr_t fileHandle = UINTPTR_MAX; //HANDLE on Windows, file descriptor on Linux, UINTPTR_MAX if not open
+		uintptr_t mappingHandle{};          //file mapping HANDLE, ONLY USED FOR WINDOWS
+	};
+}
\ No newline at end of file
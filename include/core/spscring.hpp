@@ -0,0 +1,113 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace CircuitGame::Core
+{
+	using std::atomic;
+	using std::size_t;
+	using std::vector;
+	using std::memory_order_relaxed;
+	using std::memory_order_acquire;
+	using std::memory_order_release;
+
+	//Bounded lock-free ring buffer for exactly one producer thread and one consumer thread.
+	//Capacity is rounded up to a power of two. Push and pop never block or allocate,
+	//a full ring rejects the push and the producer decides what to do with the value.
+	template<typename T>
+	class SpscRing
+	{
+	public:
+		explicit SpscRing(size_t requestedCapacity = 1024)
+		{
+			size_t capacity = 2;
+			while (capacity < requestedCapacity) capacity <<= 1;
+
+			buffer.resize(capacity);
+			mask = capacity - 1;
+		}
+
+		SpscRing(const SpscRing&) = delete;
+		SpscRing& operator=(const SpscRing&) = delete;
+
+		size_t GetCapacity() const { return buffer.size(); }
+
+		//Approximate element count, exact only when called from either owning thread while the other is idle
+		size_t GetSize() const
+		{
+			return head.load(memory_order_acquire) - tail.load(memory_order_acquire);
+		}
+
+		//Producer thread only. Returns false if the ring is full.
+		bool TryPush(const T& value)
+		{
+			size_t currentHead = head.load(memory_order_relaxed);
+
+			//only touch the consumer cache line when our cached view says we are full
+			if (currentHead - cachedTail == buffer.size())
+			{
+				cachedTail = tail.load(memory_order_acquire);
+				if (currentHead - cachedTail == buffer.size()) return false;
+			}
+
+			buffer[currentHead & mask] = value;
+			head.store(currentHead + 1, memory_order_release);
+
+			return true;
+		}
+
+		//Consumer thread only. Returns false if the ring is empty.
+		bool TryPop(T& out)
+		{
+			size_t currentTail = tail.load(memory_order_relaxed);
+
+			if (currentTail == cachedHead)
+			{
+				cachedHead = head.load(memory_order_acquire);
+				if (currentTail == cachedHead) return false;
+			}
+
+			out = buffer[currentTail & mask];
+			tail.store(currentTail + 1, memory_order_release);
+
+			return true;
+		}
+
+		//Consumer thread only. Hands every currently available element to the callback
+		//and releases them in one store, returns how many elements were consumed.
+		template<typename Callback>
+		size_t PopAll(Callback&& callback)
+		{
+			size_t currentTail = tail.load(memory_order_relaxed);
+			cachedHead = head.load(memory_order_acquire);
+
+			size_t count = cachedHead - currentTail;
+			for (size_t i = 0; i < count; i++)
+			{
+				callback(buffer[(currentTail + i) & mask]);
+			}
+
+			tail.store(cachedHead, memory_order_release);
+
+			return count;
+		}
+	private:
+		vector<T> buffer{};
+		size_t mask{};
+
+		//producer-owned cache line
+		alignas(64) atomic<size_t> head{};
+		size_t cachedTail{};
+
+		//consumer-owned cache line
+		alignas(64) atomic<size_t> tail{};
+		size_t cachedHead{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace CircuitGame::Core
+{
+	using std::condition_variable;
+	using std::size_t;
+	using std::deque;
+	using std::function;
+	using std::mutex;
+	using std::thread;
+	using std::vector;
+
+	//Fixed set of worker threads running submitted jobs in submission order
+	class ThreadPool
+	{
+	public:
+		//0 picks one thread less than the hardware has, but at least one
+		void Start(size_t threadCount = 0);
+
+		void Submit(function<void()> job);
+
+		//Drops jobs that have not started yet and waits for the running ones
+		void Stop();
+
+		size_t GetThreadCount() const { return workers.size(); }
+
+		~ThreadPool() { Stop(); }
+	private:
+		void Run();
+
+		vector<thread> workers{};
+
+		mutex jobMutex{};
+		condition_variable jobReady{};
+		deque<function<void()>> jobs{};
+		bool isStopping = false;
+	};
+}
\ No newline at end of file
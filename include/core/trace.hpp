@@ -0,0 +1,169 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <string>
+
+//Zones, counters and thread names recorded while a capture runs and written as a
+//Chrome trace that chrome://tracing and Perfetto open. Configure with CIRCUITGAME_TRACE
+//off and every macro below expands to nothing. Names must be string literals,
+//only their pointers are recorded.
+#ifdef CIRCUITGAME_TRACE
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+//Times the rest of the enclosing block
+#define TRACE_ZONE(name) ::CircuitGame::Core::TraceZone TRACE_CONCAT(traceZone, __LINE__)(name)
+
+//Records a value that is drawn as a graph over time
+#define TRACE_COUNTER(name, value) ::CircuitGame::Core::Trace::Counter(name, static_cast<double>(value))
+
+//Names the calling thread in the trace
+#define TRACE_THREAD_NAME(name) ::CircuitGame::Core::Trace::SetThreadName(name)
+
+namespace CircuitGame::Core
+{
+	using std::atomic;
+	using std::size_t;
+	using std::int64_t;
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::mutex;
+	using std::string;
+	using std::unique_ptr;
+	using std::vector;
+
+	//Events one thread can record in a capture, later ones are dropped and counted
+	inline constexpr size_t TRACE_EVENTS_PER_THREAD = 1 << 15;
+
+	enum class TraceEventType : uint8_t
+	{
+		zone,
+		counter
+	};
+
+	struct TraceEvent
+	{
+		const char* name;
+		int64_t start;    //steady clock nanoseconds
+		int64_t duration; //nanoseconds, zones only
+		double value;     //counters only
+		TraceEventType type;
+	};
+
+	//Events of one thread. Only the owning thread appends, it publishes each event by
+	//storing the new count, so the writer reads everything below the count without a lock.
+	struct TraceBuffer
+	{
+		vector<TraceEvent> events{};
+		atomic<size_t> count{};
+		atomic<size_t> dropped{};
+		atomic<uint32_t> generation{}; //capture the events belong to
+		uint32_t threadID{};
+		string threadName{}; //guarded by the registry mutex
+	};
+
+	class Trace
+	{
+	public:
+		static constexpr bool IsCompiledIn() { return true; }
+
+		static bool IsCapturing() { return isCapturing.load(std::memory_order_relaxed); }
+
+		//Forgets the previous capture and starts recording on every thread
+		static void StartCapture();
+
+		//Stops recording and writes the capture to path, returns false and fills error if it could not be written
+		static bool StopCapture(
+			const string& path,
+			string& error);
+
+		static void SetThreadName(const char* name);
+
+		static void Counter(
+			const char* name,
+			double value);
+
+		static void Zone(
+			const char* name,
+			int64_t start,
+			int64_t end);
+
+		//Steady clock nanoseconds, the time base of every event
+		static int64_t Now();
+	private:
+		//Buffer of the calling thread, created on first use and emptied when a new capture started
+		static TraceBuffer* GetBuffer(bool isRecording);
+
+		static void Append(const TraceEvent& event);
+
+		static inline atomic<bool> isCapturing{};
+		static inline atomic<uint32_t> generation{};
+		static inline int64_t captureStart{};
+
+		static inline mutex registryMutex{};
+		static inline vector<unique_ptr<TraceBuffer>> buffers{};
+	};
+
+	//Records the lifetime of the object as one zone, if a capture was running when it was created
+	class TraceZone
+	{
+	public:
+		explicit TraceZone(const char* newName) : name(newName)
+		{
+			isActive = Trace::IsCapturing();
+			if (isActive) start = Trace::Now();
+		}
+		~TraceZone()
+		{
+			if (isActive) Trace::Zone(name, start, Trace::Now());
+		}
+
+		TraceZone(const TraceZone&) = delete;
+		TraceZone& operator=(const TraceZone&) = delete;
+	private:
+		const char* name;
+		int64_t start{};
+		bool isActive{};
+	};
+}
+
+#else
+
+#define TRACE_ZONE(name) ((void)0)
+#define TRACE_COUNTER(name, value) ((void)0)
+#define TRACE_THREAD_NAME(name) ((void)0)
+
+namespace CircuitGame::Core
+{
+	using std::string;
+
+	//Compiled out, captures never start
+	class Trace
+	{
+	public:
+		static constexpr bool IsCompiledIn() { return false; }
+		static bool IsCapturing() { return false; }
+		static void StartCapture() {}
+		static bool StopCapture(
+			const string&,
+			string& error)
+		{
+			error = "tracing is compiled out";
+			return false;
+		}
+	};
+}
+
+#endif
\ No newline at end of file
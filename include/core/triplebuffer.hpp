@@ -0,0 +1,67 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace CircuitGame::Core
+{
+	using std::array;
+	using std::atomic;
+	using std::uint8_t;
+	using std::memory_order_acq_rel;
+	using std::memory_order_relaxed;
+
+	//Hands the newest value from one writer thread to one reader thread without locking or copying.
+	//The writer fills the back slot and publishes it, the reader takes the newest published slot.
+	//Values the reader never took are overwritten, neither side ever waits for the other.
+	template<typename T>
+	class TripleBuffer
+	{
+	public:
+		TripleBuffer() = default;
+
+		TripleBuffer(const TripleBuffer&) = delete;
+		TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+		//Writer thread only, the slot to fill before the next Publish.
+		//It holds whatever was written three publishes ago, so reuse its storage.
+		T& GetBack() { return slots[back]; }
+
+		//Writer thread only, swaps the filled back slot with the shared middle slot
+		void Publish()
+		{
+			uint8_t previous = middle.exchange(back | FRESH, memory_order_acq_rel);
+			back = previous & INDEX_MASK;
+		}
+
+		//Reader thread only. Takes the newest published slot if there is one the reader has not seen,
+		//returns false and leaves the front slot as it was otherwise.
+		bool Take()
+		{
+			if ((middle.load(memory_order_relaxed) & FRESH) == 0) return false;
+
+			uint8_t previous = middle.exchange(front, memory_order_acq_rel);
+			front = previous & INDEX_MASK;
+
+			return true;
+		}
+
+		//Reader thread only, the slot returned by the last successful Take
+		const T& GetFront() const { return slots[front]; }
+	private:
+		static constexpr uint8_t INDEX_MASK = 0x3;
+		static constexpr uint8_t FRESH = 0x4; //set on the middle index by Publish, cleared by Take
+
+		array<T, 3> slots{};
+
+		uint8_t back = 0;  //writer-owned
+		uint8_t front = 1; //reader-owned
+		atomic<uint8_t> middle{ 2 };
+	};
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <chrono>
+
+//kalawindow
+#include "graphics/window.hpp"
+
+namespace CircuitGame::Core
+{
+	using std::chrono::nanoseconds;
+
+	//kalawindow
+	using KalaWindow::Graphics::Window;
+
+	//Blocks the main thread on the OS event queue of a window, so a hidden or unfocused
+	//window costs no CPU until something actually happens to it.
+	//The X11 connection is polled on Linux, the thread message queue is waited on on Windows.
+	class WindowEvents
+	{
+	public:
+		//Returns as soon as the window has an event waiting or once timeout has passed,
+		//true if an event is waiting. Events already queued return at once without blocking.
+		static bool WaitFor(
+			Window* window,
+			nanoseconds timeout);
+	};
+}
\ No newline at end of file
@@ -7,37 +7,42 @@
 
 #include <string>
 
-//kalawindow
-#include "graphics/opengl/shader_opengl.hpp"
-
 #include "gameobjects/gameobject.hpp"
 #include "graphics/texture.hpp"
+#include "graphics/mesh.hpp"
 
 namespace CircuitGame::GameObjects
 {
 	using std::string;
 
-	//kalawindow
-	using KalaWindow::Graphics::OpenGL::Shader_OpenGL;
-
 	using CircuitGame::Graphics::Texture;
+	using CircuitGame::Graphics::MeshHandle;
 
 	class Cube : public GameObject
 	{
 	public:
 		static Cube* Initialize(
 			const string& name,
-			Shader_OpenGL* shader,
+			ShaderProgram* shader,
 			const vec3& pos = vec3(0),
 			const vec3& rot = vec3(0),
 			const vec3& scale = vec3(1));
 
 		const Texture* GetTexture() { return texture; }
-		void SetTexture(Texture* newTexture) { texture = newTexture; }
+		void SetTexture(Texture* newTexture)
+		{
+			texture = newTexture;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		const MeshHandle& GetMesh() const { return mesh; }
 
 		bool Render() override;
 		~Cube() override;
 	private:
 		Texture* texture{};
+
+		//shared by every cube, uploaded once by the mesh registry
+		MeshHandle mesh{};
 	};
 }
\ No newline at end of file
@@ -5,11 +5,39 @@
 
 #pragma once
 
+#include <string>
+
+#include "gameobjects/gameobject.hpp"
+#include "graphics/sceneuniforms.hpp"
+
 namespace CircuitGame::GameObjects
 {
-	class DirLight
+	using std::string;
+
+	using CircuitGame::Graphics::DirLightData;
+
+	//A light shining along one direction everywhere, like the sun.
+	//The scene has a single one, the last one rendered in a frame lights it.
+	class DirLight : public GameObject
 	{
 	public:
-		static DirLight* Initialize();
+		static DirLight* Initialize(
+			const string& name,
+			const DirLightData& light);
+
+		const DirLightData& GetLight() const { return light; }
+		void SetLight(const DirLightData& newLight)
+		{
+			light = newLight;
+			isDirty = true;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		//Hands the light to the scene uniforms, they are only uploaded again after it changed
+		bool Render() override;
+		~DirLight() override;
+	private:
+		DirLightData light{};
+		bool isDirty = true;
 	};
 }
\ No newline at end of file
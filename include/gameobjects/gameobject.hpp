@@ -8,13 +8,17 @@
 #include <string>
 
 #include "core/platform.hpp"
-#include "graphics/opengl/shader_opengl.hpp"
+
+#include "graphics/redrawtracker.hpp"
+#include "graphics/shaderprogram.hpp"
 
 namespace CircuitGame::GameObjects
 {
 	using std::string;
 
-	using KalaWindow::Graphics::OpenGL::Shader_OpenGL;
+	using CircuitGame::Graphics::ShaderProgram;
+	using CircuitGame::Graphics::RedrawTracker;
+	using CircuitGame::Graphics::RedrawReason;
 
 	enum class GameObjectType
 	{
@@ -23,11 +27,16 @@ namespace CircuitGame::GameObjects
 		dirLight
 	};
 
+	//Setters that change what is drawn request a redraw of the scene
 	class GameObject
 	{
 	public:
 		bool CanUpdate() const { return canUpdate; }
-		void SetUpdate(bool newCanUpdate) { canUpdate = newCanUpdate; }
+		void SetUpdate(bool newCanUpdate)
+		{
+			canUpdate = newCanUpdate;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
 
 		GameObjectType GetGameObjectType() const { return type; }
 		void SetGameObjectType(GameObjectType newType) { type = newType; }
@@ -36,16 +45,32 @@ namespace CircuitGame::GameObjects
 		void SetName(const string& newName) { name = newName; }
 
 		const vec3& GetPos() const { return pos; }
-		void SetPos(const vec3& newPos) { pos = newPos; }
+		void SetPos(const vec3& newPos)
+		{
+			pos = newPos;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
 
 		const vec3& GetRot() const { return rot; }
-		void SetRot(const vec3& newRot) { rot = newRot; }
+		void SetRot(const vec3& newRot)
+		{
+			rot = newRot;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
 
 		const vec3& GetScale() const { return scale; };
-		void SetScale(const vec3& newScale) { scale = newScale; }
-
-		const Shader_OpenGL* GetShader() const { return shader; }
-		void SetShader(Shader_OpenGL* newShader) { shader = newShader; }
+		void SetScale(const vec3& newScale)
+		{
+			scale = newScale;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		const ShaderProgram* GetShader() const { return shader; }
+		void SetShader(ShaderProgram* newShader)
+		{
+			shader = newShader;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
 
 		virtual bool Render() = 0;
 
@@ -60,7 +85,7 @@ namespace CircuitGame::GameObjects
 		vec3 rot{};
 		vec3 scale{};
 
-		Shader_OpenGL* shader{};
+		ShaderProgram* shader{};
 	};
 
 	inline GameObject::~GameObject() {}
@@ -5,11 +5,56 @@
 
 #pragma once
 
+#include <string>
+
+#include "gameobjects/gameobject.hpp"
+#include "graphics/lightclusters.hpp"
+
 namespace CircuitGame::GameObjects
 {
-	class PointLight
+	using std::string;
+
+	using CircuitGame::Graphics::PointLightData;
+
+	//A light shining in every direction from the position of the object,
+	//any number of them can exist since each fragment only shades the ones near it
+	class PointLight : public GameObject
 	{
 	public:
-		static PointLight* Initialize();
+		static PointLight* Initialize(
+			const string& name,
+			const vec3& pos = vec3(0),
+			const vec3& color = vec3(1),
+			float intensity = 1.0f,
+			float radius = 5.0f);
+
+		//The position is ignored, the light always sits at the position of the object
+		const PointLightData& GetLight() const { return light; }
+		void SetLight(const PointLightData& newLight)
+		{
+			light = newLight;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		//Sets the diffuse and specular color and a faint ambient one
+		void SetColor(const vec3& color);
+
+		void SetIntensity(float intensity)
+		{
+			light.intensity = intensity;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		void SetRadius(float radius)
+		{
+			light.radius = radius;
+			RedrawTracker::Request(RedrawReason::scene);
+		}
+
+		//Submits the light to the light clusters of this frame
+		bool Render() override;
+		~PointLight() override;
+	private:
+		PointLightData light{};
 	};
 }
\ No newline at end of file
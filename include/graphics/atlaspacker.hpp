@@ -0,0 +1,57 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace CircuitGame::Graphics
+{
+	using std::uint32_t;
+	using std::vector;
+
+	//Placement of one packed rectangle, x and y point past the padding at its top left corner
+	struct AtlasRect
+	{
+		uint32_t x{};
+		uint32_t y{};
+		uint32_t width{};
+		uint32_t height{};
+		uint32_t layer{};
+	};
+
+	//Packs rectangles onto square layers with shelves: rectangles are placed by decreasing height
+	//left to right, a new shelf starts below the tallest rectangle of the last one
+	//and a new layer starts once a layer is full
+	class AtlasPacker
+	{
+	public:
+		//padding is kept free around every rectangle so filtering and mipmaps
+		//do not bleed neighbours into each other
+		AtlasPacker(
+			uint32_t layerSize,
+			uint32_t padding);
+
+		//Adds a rectangle to pack, returns its index into the rects of Pack
+		uint32_t Add(
+			uint32_t width,
+			uint32_t height);
+
+		//Places every added rectangle, returns false if one is larger than a layer
+		bool Pack();
+
+		const vector<AtlasRect>& GetRects() const { return rects; }
+		uint32_t GetLayerCount() const { return layerCount; }
+		uint32_t GetLayerSize() const { return layerSize; }
+		uint32_t GetPadding() const { return padding; }
+	private:
+		uint32_t layerSize{};
+		uint32_t padding{};
+
+		vector<AtlasRect> rects{};
+		uint32_t layerCount{};
+	};
+}
\ No newline at end of file
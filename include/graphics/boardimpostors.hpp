@@ -0,0 +1,109 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/shaderprogram.hpp"
+#include "graphics/boxculler.hpp"
+#include "graphics/frustum.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::vector;
+
+	//Gates along one side of an impostor chunk
+	inline constexpr uint32_t IMPOSTOR_CHUNK_SIDE = 64;
+
+	//Texels along one side of an impostor, two per gate
+	inline constexpr GLsizei IMPOSTOR_SIZE = 128;
+
+	enum class ImpostorState : uint8_t
+	{
+		missing, //never rendered, must be rendered before it is shown
+		stale,   //shows an older simulation state, refreshed within the render budget
+		current
+	};
+
+	//One textured quad of the overview, read by the vertex shader per instance
+	struct ImpostorQuad
+	{
+		vec4 rect;   //location 1, world min in xy and max in zw
+		float layer; //location 2, layer of the impostor texture array
+	};
+
+	//Zoomed-out level of detail of the board. Every chunk of gates and wires is rendered
+	//into a layer of a low-resolution array texture, and once a gate covers fewer pixels
+	//than its impostor texels the board is drawn as one quad per chunk instead.
+	//Impostors are only rendered again after the board or the net states changed.
+	class BoardImpostors
+	{
+	public:
+		static bool Initialize(const ShaderProgram* shader);
+
+		//Lays out one impostor per chunk of a grid of side x rows gates spaced spacing apart,
+		//all of them are rendered again before they are shown
+		static void Reset(
+			uint32_t side,
+			uint32_t rows,
+			float spacing);
+
+		//The net states changed, every rendered impostor is refreshed over the next frames
+		static void MarkStale();
+
+		//True if the camera is zoomed out far enough for impostors to replace the board
+		static bool IsActive();
+
+		//Renders the missing impostors of the visible chunks and up to a budget of the stale ones
+		//through the board and wire renderers. Must run before the frame is drawn.
+		//Returns true if visible impostors are still stale afterwards.
+		static bool Update();
+
+		//Tests every chunk against frustum and collects the quads of the visible ones
+		static void Cull(const Frustum& frustum);
+
+		//Draws the quads collected by the last Cull in one call
+		static void Draw();
+
+		static void Shutdown();
+	private:
+		//Renders chunk into its layer of the impostor texture
+		static void RenderChunk(uint32_t chunk);
+
+		//Rebuilds the mips of one layer from its level 0, leaving every other layer alone
+		static void DownsampleLayer(uint32_t layer);
+
+		static inline const ShaderProgram* shader{};
+
+		static inline GLuint texture{};
+		static inline GLuint framebuffer{};
+		static inline GLuint depthBuffer{};
+		static inline GLuint mipReadFramebuffer{};
+		static inline GLuint mipDrawFramebuffer{};
+		static inline GLint maxLayers{};
+
+		static inline GLuint quadVAO{};
+		static inline GLuint cornerVBO{};
+		static inline GLuint instanceVBO{};
+
+		static inline uint32_t chunkColumns{};
+		static inline uint32_t chunkRows{};
+		static inline float spacing = 1.0f;
+
+		static inline vector<ImpostorState> states{}; //indexed like the boxes in chunkCuller
+		static inline BoxCuller chunkCuller{};
+
+		static inline vector<uint32_t> visibleChunks{};
+		static inline vector<ImpostorQuad> visibleQuads{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "graphics/instancebatch.hpp"
+#include "graphics/shaderprogram.hpp"
+#include "graphics/texture.hpp"
+#include "graphics/mesh.hpp"
+#include "graphics/boxculler.hpp"
+#include "graphics/frustum.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::unique_ptr;
+	using std::vector;
+
+	//Consecutive instances of the board batch
+	struct InstanceRange
+	{
+		size_t first;
+		size_t count;
+	};
+
+	//Draws every gate of the simulated board as one instance of a shared mesh,
+	//laid out on a square grid and tinted by gate type.
+	//The grid is cut into square chunks whose instances are stored next to each other,
+	//so the visible part of the board is drawn as a few ranges of one batch.
+	//Every net is routed from its driver to each gate reading it through the wire renderer,
+	//and the board impostors are laid out again whenever the instances are rebuilt.
+	class BoardView
+	{
+	public:
+		static bool Initialize(
+			const ShaderProgram* shader,
+			const ShaderProgram* wireShader,
+			const ShaderProgram* impostorShader,
+			const Texture* texture,
+			const MeshHandle& mesh);
+
+		//Rebuilds the instances if the gate count or the texture changed since the last call
+		//and frames the camera on the new layout
+		static void Refresh();
+
+		//Tests every chunk against frustum and merges the visible ones into ranges
+		static void Cull(const Frustum& frustum);
+
+		static InstanceBatch* GetBatch() { return batch.get(); }
+
+		//Ranges of the batch that passed the last Cull, in ascending order
+		static const vector<InstanceRange>& GetVisibleRanges() { return visibleRanges; }
+
+		static void Shutdown();
+	private:
+		//Routes the input nets of gates from firstGate on, and the nets those gates drive,
+		//as L-shaped wires from the driving gate to the reading gate
+		static void AddWires(
+			uint32_t firstGate,
+			uint32_t side);
+
+		static inline unique_ptr<InstanceBatch> batch{};
+
+		static inline vector<InstanceRange> chunkRanges{}; //indexed like the boxes in chunkCuller
+		static inline BoxCuller chunkCuller{};
+
+		static inline vector<uint32_t> visibleChunks{};
+		static inline vector<InstanceRange> visibleRanges{};
+
+		static inline uint32_t lastGateCount = UINT32_MAX;
+		static inline uint32_t lastSide{};
+		static inline unsigned int lastTextureID{}; //the loader swaps the placeholder for the real array
+	};
+}
\ No newline at end of file
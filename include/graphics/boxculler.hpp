@@ -0,0 +1,52 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+
+#include "graphics/frustum.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::vector;
+
+	//Axis-aligned boxes stored as one array per coordinate,
+	//so a frustum test covers four boxes per SSE instruction
+	class BoxCuller
+	{
+	public:
+		//Returns the index of the new box, indices follow insertion order
+		uint32_t Add(
+			const vec3& min,
+			const vec3& max);
+
+		void Clear();
+
+		size_t GetCount() const { return count; }
+
+		//Appends the index of every box touching the frustum to visible, in ascending order
+		void Cull(
+			const Frustum& frustum,
+			vector<uint32_t>& visible) const;
+	private:
+		//padded to a multiple of four, the padding is never reported
+		vector<float> minX{};
+		vector<float> minY{};
+		vector<float> minZ{};
+		vector<float> maxX{};
+		vector<float> maxY{};
+		vector<float> maxZ{};
+
+		size_t count{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+//kalawindow
+#include "core/platform.hpp"
+
+#include "graphics/frustum.hpp"
+
+namespace CircuitGame::Graphics
+{
+	//Perspective camera looking straight down the -z axis at the board plane (z = 0)
+	class Camera
+	{
+	public:
+		//Moves the camera so the rectangle min to max of the board plane fills the view
+		static void Frame(
+			const vec2& min,
+			const vec2& max);
+
+		//Call whenever the window is resized so the aspect ratio follows
+		static void SetViewSize(const vec2& newViewSize);
+
+		//Moves the camera so the board follows a mouse drag of pixelDelta (y down)
+		static void Pan(const vec2& pixelDelta);
+
+		//Positive steps move closer to the board, negative steps away from it
+		static void Zoom(float steps);
+
+		static const vec3& GetPosition() { return position; }
+		static const mat4& GetView() { return view; }
+		static const mat4& GetProjection() { return projection; }
+		static const vec2& GetViewSize() { return viewSize; }
+		static const Frustum& GetFrustum() { return frustum; }
+
+		//Pixels one world unit of the board plane covers at the current zoom
+		static float GetPixelsPerUnit();
+	private:
+		static void UpdateMatrices();
+
+		static inline vec3 position = vec3(0.0f, 0.0f, 15.0f);
+		static inline vec2 viewSize = vec2(800.0f, 600.0f);
+
+		static inline float fieldOfView = 45.0f; //vertical, in degrees
+
+		static inline mat4 view = mat4(1.0f);
+		static inline mat4 projection = mat4(1.0f);
+
+		static inline Frustum frustum{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/redrawtracker.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::array;
+	using std::size_t;
+	using std::uint8_t;
+	using std::chrono::steady_clock;
+	using std::chrono::time_point;
+
+	//Parts of a frame timed on the CPU, stacked in this order in the graph
+	enum class CpuScope : uint8_t
+	{
+		windowUpdate,  //window messages
+		input,         //hotkeys and camera controls
+		simulation,    //draining probes and taking the newest net states
+		uploads,       //finished textures, board layout and wire chunks
+		impostors,     //offscreen impostor passes
+		instanceBuild, //queuing instances, lights and sorting the render queue
+		culling,       //frustum tests of the board, wires and impostors
+		submit,        //uniform uploads and draw calls
+		swap,          //buffer swap, vsync waits here
+		count
+	};
+
+	//Parts of a frame timed on the GPU, only one can be measured at a time
+	enum class GpuPass : uint8_t
+	{
+		impostors, //offscreen impostor passes
+		scene,     //cubes and gates
+		board,     //wires or impostor quads
+		overlay,   //probes and the profiler itself
+		count
+	};
+
+	inline constexpr size_t CPU_SCOPE_COUNT = static_cast<size_t>(CpuScope::count);
+	inline constexpr size_t GPU_PASS_COUNT = static_cast<size_t>(GpuPass::count);
+
+	//Frames kept for the graph, one column each
+	inline constexpr size_t PROFILER_HISTORY = 240;
+
+	//Query sets the GPU timers rotate through, results are read a frame after they were issued
+	inline constexpr size_t PROFILER_QUERY_SETS = 2;
+
+	struct ProfiledFrame
+	{
+		array<float, CPU_SCOPE_COUNT> cpuMs{};
+		array<float, GPU_PASS_COUNT> gpuMs{}; //results that arrived this frame, they belong to an earlier one
+		float frameMs{};                       //whole main loop iteration, sleeping included
+	};
+
+	//Named CPU scopes and GL_TIME_ELAPSED timers of every main loop iteration,
+	//shown as a graph in the overlay. The GPU timers use two sets of queries
+	//that are only read once the driver reports them available, so reading never stalls.
+	//Nothing is measured while the graph is hidden.
+	class FrameProfiler
+	{
+	public:
+		static bool Initialize();
+
+		static bool IsVisible() { return isVisible; }
+		static void SetVisible(bool newVisible)
+		{
+			isVisible = newVisible;
+			RedrawTracker::Request(RedrawReason::ui);
+		}
+
+		//Starts a main loop iteration and collects the GPU timers that finished since the last one
+		static void BeginFrame();
+
+		//Stores the iteration in the history, logs the averages once a second
+		//and requests a redraw so the graph keeps moving
+		static void EndFrame();
+
+		//A scope may be entered several times a frame, its times add up
+		static void BeginCpu(CpuScope scope);
+		static void EndCpu(CpuScope scope);
+
+		//Passes must not overlap, GL has a single time elapsed timer
+		static void BeginGpu(GpuPass pass);
+		static void EndGpu();
+
+		//Queues the graph into the overlay, CPU scopes stack upwards and GPU passes downwards
+		static void Draw(const vec2& viewSize);
+
+		static void Shutdown();
+	private:
+		static inline bool isInitialized = false;
+		static inline bool isVisible = false;
+		static inline bool isFrameActive = false;
+
+		static inline time_point<steady_clock> frameStart{};
+		static inline array<time_point<steady_clock>, CPU_SCOPE_COUNT> scopeStarts{};
+		static inline ProfiledFrame frame{};
+
+		static inline GLuint queries[PROFILER_QUERY_SETS][GPU_PASS_COUNT]{};
+		static inline bool isQueryPending[PROFILER_QUERY_SETS][GPU_PASS_COUNT]{};
+		static inline size_t querySet{};
+		static inline bool isQuerySetUsed = false;
+		static inline bool isGpuPassActive = false;
+
+		static inline array<ProfiledFrame, PROFILER_HISTORY> history{};
+		static inline size_t historyNext{};
+
+		//sums since the last logged summary
+		static inline ProfiledFrame summarySum{};
+		static inline array<size_t, GPU_PASS_COUNT> summaryGpuSamples{};
+		static inline size_t summaryFrames{};
+		static inline time_point<steady_clock> lastSummary{};
+	};
+
+	//Times the enclosing block as one CPU scope
+	class CpuProfileScope
+	{
+	public:
+		explicit CpuProfileScope(CpuScope newScope) : scope(newScope) { FrameProfiler::BeginCpu(scope); }
+		~CpuProfileScope() { FrameProfiler::EndCpu(scope); }
+
+		CpuProfileScope(const CpuProfileScope&) = delete;
+		CpuProfileScope& operator=(const CpuProfileScope&) = delete;
+	private:
+		CpuScope scope;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+//kalawindow
+#include "core/platform.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::array;
+	using std::size_t;
+
+	//The six clip planes of a view-projection matrix, normals point into the visible volume.
+	//Planes are not normalized, they are only used for sign tests.
+	class Frustum
+	{
+	public:
+		static constexpr size_t PLANE_COUNT = 6;
+
+		void Update(const mat4& viewProjection);
+
+		//Conservative: a box straddling a corner of the frustum may pass
+		bool Intersects(
+			const vec3& min,
+			const vec3& max) const;
+
+		//xyz is the normal, w the distance term
+		const vec4& GetPlane(size_t index) const { return planes[index]; }
+	private:
+		array<vec4, PLANE_COUNT> planes{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,298 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+//OpenGL functions and enums this program needs that KalaWindow does not load,
+//declared the same way as the KalaWindow ones so call sites look identical
+
+using GLuint64 = uint64_t;
+
+//Buffer targets
+
+inline constexpr GLenum GL_ELEMENT_ARRAY_BUFFER = 0x8893; //Vertex index buffer
+inline constexpr GLenum GL_UNIFORM_BUFFER       = 0x8A11; //Backing store of a uniform block
+inline constexpr GLenum GL_PIXEL_UNPACK_BUFFER  = 0x88EC; //Source of texture uploads, pixel pointers become offsets
+inline constexpr GLenum GL_TEXTURE_BUFFER       = 0x8C2A; //Backing store of a buffer texture, also its texture target
+
+//Buffer mapping
+
+inline constexpr GLbitfield GL_MAP_WRITE_BIT             = 0x0002; //Mapping is written to
+inline constexpr GLbitfield GL_MAP_INVALIDATE_BUFFER_BIT = 0x0008; //Previous contents may be discarded
+
+//Buffer usage
+
+inline constexpr GLenum GL_STREAM_DRAW  = 0x88E0; //Data modified every frame, used a few times
+inline constexpr GLenum GL_DYNAMIC_DRAW = 0x88E8; //Data modified often, used many times
+
+//Shader parameter enums
+
+inline constexpr GLenum GL_ACTIVE_UNIFORM_MAX_LENGTH = 0x8B87; //Longest active uniform name including the terminator
+
+inline constexpr GLuint GL_INVALID_INDEX = 0xFFFFFFFFu; //Returned for a uniform block the program does not use
+
+//Texture usage
+
+inline constexpr GLenum GL_TEXTURE_2D_ARRAY     = 0x8C1A; //Layered 2D texture target
+inline constexpr GLenum GL_RGBA8                = 0x8058; //8 bits per channel RGBA storage
+inline constexpr GLenum GL_LINEAR_MIPMAP_LINEAR = 0x2703; //Trilinear minification filter
+inline constexpr GLenum GL_R32UI                = 0x8236; //One unsigned 32-bit integer per texel
+inline constexpr GLenum GL_RG32UI               = 0x823C; //Two unsigned 32-bit integers per texel
+inline constexpr GLenum GL_RGBA32F              = 0x8814; //Four 32-bit floats per texel
+
+inline constexpr GLenum GL_MAX_ARRAY_TEXTURE_LAYERS = 0x88FF; //Most layers an array texture may have
+inline constexpr GLenum GL_MAX_TEXTURE_BUFFER_SIZE  = 0x8C2B; //Most texels a buffer texture may address
+
+//Program binaries
+
+inline constexpr GLenum GL_PROGRAM_BINARY_RETRIEVABLE_HINT = 0x8257; //Keep the linked binary so it can be read back
+inline constexpr GLenum GL_PROGRAM_BINARY_LENGTH           = 0x8741; //Size of the linked binary in bytes
+inline constexpr GLenum GL_NUM_PROGRAM_BINARY_FORMATS      = 0x87FE; //Binary formats the driver can return, 0 if none
+
+//Queries
+
+inline constexpr GLenum GL_TIME_ELAPSED           = 0x88BF; //Nanoseconds the GPU spent on the commands between begin and end
+inline constexpr GLenum GL_QUERY_RESULT           = 0x8866; //Result of a query, waits for it to finish
+inline constexpr GLenum GL_QUERY_RESULT_AVAILABLE = 0x8867; //True once the result can be read without waiting
+
+//Framebuffers
+
+inline constexpr GLenum GL_READ_FRAMEBUFFER = 0x8CA8; //Framebuffer blits and reads take pixels from
+inline constexpr GLenum GL_DRAW_FRAMEBUFFER = 0x8CA9; //Framebuffer draws and blits write to
+
+//Capabilities
+
+inline constexpr GLenum GL_DEPTH_TEST = 0x0B71; //Depth testing of fragments
+
+//
+// GEOMETRY
+//
+
+//Enables a server-side capability
+extern void (K_APIENTRY* glEnable)(
+	GLenum cap);
+
+//Updates a part of the data store of the bound buffer
+extern void (K_APIENTRY* glBufferSubData)(
+	GLenum target,
+	GLintptr offset,
+	GLsizeiptr size,
+	const void* data);
+
+//Sets how many instances share one element of a vertex attribute, 0 advances per vertex
+extern void (K_APIENTRY* glVertexAttribDivisor)(
+	GLuint index,
+	GLuint divisor);
+
+//Like glVertexAttribPointer, but the shader reads the values as integers instead of floats
+extern void (K_APIENTRY* glVertexAttribIPointer)(
+	GLuint index,
+	GLint size,
+	GLenum type,
+	GLsizei stride,
+	const void* pointer);
+
+//Draws instanceCount copies of a range of vertices
+extern void (K_APIENTRY* glDrawArraysInstanced)(
+	GLenum mode,
+	GLint first,
+	GLsizei count,
+	GLsizei instanceCount);
+
+//Draws instanceCount copies of indexed geometry
+extern void (K_APIENTRY* glDrawElementsInstanced)(
+	GLenum mode,
+	GLsizei count,
+	GLenum type,
+	const void* indices,
+	GLsizei instanceCount);
+
+//
+// TEXTURES
+//
+
+//Allocates a 3D or array texture and optionally fills it
+extern void (K_APIENTRY* glTexImage3D)(
+	GLenum target,
+	GLint level,
+	GLint internalFormat,
+	GLsizei width,
+	GLsizei height,
+	GLsizei depth,
+	GLint border,
+	GLenum format,
+	GLenum type,
+	const void* data);
+
+//Replaces a box of an existing 3D or array texture, depth counts layers
+extern void (K_APIENTRY* glTexSubImage3D)(
+	GLenum target,
+	GLint level,
+	GLint xoffset,
+	GLint yoffset,
+	GLint zoffset,
+	GLsizei width,
+	GLsizei height,
+	GLsizei depth,
+	GLenum format,
+	GLenum type,
+	const void* pixels);
+
+//Makes buffer the storage of the buffer texture bound to target
+extern void (K_APIENTRY* glTexBuffer)(
+	GLenum target,
+	GLenum internalformat,
+	GLuint buffer);
+
+//Maps a range of the bound buffer into client memory
+extern void* (K_APIENTRY* glMapBufferRange)(
+	GLenum target,
+	GLintptr offset,
+	GLsizeiptr length,
+	GLbitfield access);
+
+//Releases the mapping of the bound buffer, returns false if its contents were lost
+extern GLboolean (K_APIENTRY* glUnmapBuffer)(
+	GLenum target);
+
+//
+// FRAMEBUFFERS
+//
+
+//Attaches one layer of an array texture level to a framebuffer attachment point
+extern void (K_APIENTRY* glFramebufferTextureLayer)(
+	GLenum target,
+	GLenum attachment,
+	GLuint texture,
+	GLint level,
+	GLint layer);
+
+//Copies a rectangle of the read framebuffer into the draw framebuffer, scaling with filter
+extern void (K_APIENTRY* glBlitFramebuffer)(
+	GLint srcX0,
+	GLint srcY0,
+	GLint srcX1,
+	GLint srcY1,
+	GLint dstX0,
+	GLint dstY0,
+	GLint dstX1,
+	GLint dstY1,
+	GLbitfield mask,
+	GLenum filter);
+
+extern void (K_APIENTRY* glDeleteFramebuffers)(
+	GLsizei n,
+	const GLuint* framebuffers);
+
+extern void (K_APIENTRY* glDeleteRenderbuffers)(
+	GLsizei n,
+	const GLuint* renderbuffers);
+
+//
+// QUERIES
+//
+
+extern void (K_APIENTRY* glGenQueries)(
+	GLsizei n,
+	GLuint* ids);
+
+extern void (K_APIENTRY* glDeleteQueries)(
+	GLsizei n,
+	const GLuint* ids);
+
+//Starts measuring the commands that follow, only one query per target can be active
+extern void (K_APIENTRY* glBeginQuery)(
+	GLenum target,
+	GLuint id);
+
+extern void (K_APIENTRY* glEndQuery)(
+	GLenum target);
+
+//Reads the availability or a 32-bit result of a finished query
+extern void (K_APIENTRY* glGetQueryObjectuiv)(
+	GLuint id,
+	GLenum pname,
+	GLuint* params);
+
+//Reads the 64-bit result of a finished query, timer results do not fit 32 bits
+extern void (K_APIENTRY* glGetQueryObjectui64v)(
+	GLuint id,
+	GLenum pname,
+	GLuint64* params);
+
+//
+// UNIFORMS
+//
+
+//Reads the name, array size and type of the active uniform at index
+extern void (K_APIENTRY* glGetActiveUniform)(
+	GLuint program,
+	GLuint index,
+	GLsizei bufSize,
+	GLsizei* length,
+	GLint* size,
+	GLenum* type,
+	char* name);
+
+//Returns the index of a named uniform block, or GL_INVALID_INDEX
+extern GLuint (K_APIENTRY* glGetUniformBlockIndex)(
+	GLuint program,
+	const char* uniformBlockName);
+
+//Assigns a uniform block of program to a uniform buffer binding point
+extern void (K_APIENTRY* glUniformBlockBinding)(
+	GLuint program,
+	GLuint uniformBlockIndex,
+	GLuint uniformBlockBinding);
+
+//Binds a whole buffer to an indexed binding point of target
+extern void (K_APIENTRY* glBindBufferBase)(
+	GLenum target,
+	GLuint index,
+	GLuint buffer);
+
+//
+// PROGRAM BINARIES, OPTIONAL
+//
+
+//Sets a parameter of program, used for the retrievable binary hint
+extern void (K_APIENTRY* glProgramParameteri)(
+	GLuint program,
+	GLenum pname,
+	GLint value);
+
+//Reads the linked binary of program and the driver specific format it is in
+extern void (K_APIENTRY* glGetProgramBinary)(
+	GLuint program,
+	GLsizei bufSize,
+	GLsizei* length,
+	GLenum* binaryFormat,
+	void* binary);
+
+//Loads a binary read with glGetProgramBinary, the link status tells if the driver accepted it
+extern void (K_APIENTRY* glProgramBinary)(
+	GLuint program,
+	GLenum binaryFormat,
+	const void* binary,
+	GLsizei length);
+
+namespace CircuitGame::Graphics
+{
+	class GLExtensions
+	{
+	public:
+		//Loads every function above, requires a current context.
+		//Returns false if any of them is missing, optional ones only disable their feature.
+		static bool Initialize();
+
+		//Program binaries can be read back and loaded, needs GL 4.1 or ARB_get_program_binary
+		static bool HasProgramBinary() { return hasProgramBinary; }
+	private:
+		static inline bool hasProgramBinary = false;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,62 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/shaderprogram.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::uint32_t;
+
+	struct GLStateCounters
+	{
+		uint32_t issued{};  //calls that reached the driver
+		uint32_t skipped{}; //calls that would have set the current value again
+	};
+
+	//Shadow copy of the GL binding and capability state this program touches.
+	//Every bind goes through here so calls that would not change anything never reach the driver.
+	//Code that changes this state with raw GL calls must call Invalidate afterwards.
+	class GLState
+	{
+	public:
+		//Binds the program of shader, returns false if the shader could not be bound
+		static bool UseShader(const ShaderProgram* shader);
+
+		static void BindVertexArray(GLuint vertexArray);
+
+		//Selects the unit and binds texture to target on it
+		static void BindTexture(
+			GLuint unit,
+			GLenum target,
+			GLuint texture);
+
+		//GL_DEPTH_TEST, GL_BLEND and the other glEnable/glDisable capabilities
+		static void SetCapability(
+			GLenum capability,
+			bool isEnabled);
+
+		//Deleting a bound object resets its binding to 0, call these right after the glDelete* call
+		static void OnVertexArrayDeleted(GLuint vertexArray);
+		static void OnTextureDeleted(GLuint texture);
+
+		//Forgets everything, the next call of each kind is always issued
+		static void Invalidate();
+
+		//Publishes the counters of the finished frame and starts counting the next one
+		static void EndFrame();
+
+		static const GLStateCounters& GetLastFrameCounters() { return lastFrame; }
+	private:
+		static inline GLStateCounters frame{};
+		static inline GLStateCounters lastFrame{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+
+#include "graphics/shaderprogram.hpp"
+#include "graphics/texture.hpp"
+#include "graphics/mesh.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::vector;
+
+	//Instances not tied to a net keep their color regardless of the simulation
+	inline constexpr uint32_t INSTANCE_NO_NET = UINT32_MAX;
+
+	//Per-object data read by the vertex shader, attribute locations 3 to 10
+	struct InstanceData
+	{
+		mat4 model;   //locations 3, 4, 5 and 6, one column each
+		vec4 color;   //location 7, multiplied with the lit texture color
+		vec4 uvRect;  //location 8, texture region offset in xy and scale in zw
+		float layer;  //location 9, texture array layer
+		uint32_t net; //location 10, net whose state in the net state buffer lights the instance
+	};
+
+	//Every object sharing one shader, texture and mesh, drawn with a single instanced call.
+	//The instances are only uploaded again after they were changed.
+	class InstanceBatch
+	{
+	public:
+		InstanceBatch(
+			const ShaderProgram* shader,
+			const Texture* texture,
+			const MeshHandle& mesh);
+
+		const ShaderProgram* GetShader() const { return shader; }
+		const Texture* GetTexture() const { return texture; }
+		const Mesh* GetMesh() const { return mesh.get(); }
+
+		size_t GetInstanceCount() const { return instances.size(); }
+
+		//region selects the sprite when the texture of this batch is an array
+		void Add(
+			const mat4& model,
+			const vec4& color,
+			const TextureRegion& region = {},
+			uint32_t net = INSTANCE_NO_NET)
+		{
+			instances.push_back({ model, color, region.uvRect, region.layer, net });
+			isDirty = true;
+		}
+
+		void Clear()
+		{
+			instances.clear();
+			isDirty = true;
+		}
+
+		//Expects the shader, texture and mesh VAO of this batch to be bound,
+		//points the instance attributes at this batch's buffer and draws every instance
+		void Draw();
+
+		//Same as Draw, but only count instances starting at first
+		void Draw(
+			size_t first,
+			size_t count);
+
+		~InstanceBatch();
+	private:
+		void Upload();
+
+		const ShaderProgram* shader{};
+		const Texture* texture{};
+
+		MeshHandle mesh{}; //keeps the mesh alive for as long as the batch draws it
+
+		unsigned int instanceVBO{};
+		size_t instanceCapacity{}; //instances the buffer store can hold
+
+		vector<InstanceData> instances{};
+		bool isDirty = false;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::vector;
+
+	//Must match CLUSTERS_X, CLUSTERS_Y and CLUSTERS_Z in the shaders
+	inline constexpr uint32_t CLUSTERS_X = 16;
+	inline constexpr uint32_t CLUSTERS_Y = 9;
+	inline constexpr uint32_t CLUSTERS_Z = 24;
+	inline constexpr uint32_t CLUSTER_COUNT = CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z;
+
+	//Texture units of the cluster buffers, programs read them through buffer samplers
+	inline constexpr GLuint CLUSTER_LIGHTS_TEXTURE_UNIT = 2;
+	inline constexpr GLuint CLUSTER_RANGES_TEXTURE_UNIT = 3;
+	inline constexpr GLuint CLUSTER_INDICES_TEXTURE_UNIT = 4;
+
+	//RGBA32F texels one light takes in the light buffer
+	inline constexpr uint32_t LIGHT_TEXELS = 5;
+
+	struct PointLightData
+	{
+		vec3 position;
+		float intensity;
+		float radius; //no light reaches further, attenuation distances are measured in radii
+
+		float constant;
+		float linear;
+		float quadratic;
+
+		vec3 ambient;
+		vec3 diffuse;
+		vec3 specular;
+	};
+
+	//Clustered forward lighting. The view volume of the main camera is cut into
+	//CLUSTERS_X x CLUSTERS_Y screen tiles and CLUSTERS_Z exponential depth slices,
+	//every frame each point light is listed in the clusters its sphere reaches,
+	//and a fragment only shades the lights listed in its own cluster.
+	//Lights, per-cluster ranges and the index lists live in three buffer textures.
+	class LightClusters
+	{
+	public:
+		static bool Initialize();
+
+		//Forgets the lights submitted for the last frame
+		static void Clear();
+
+		//Adds a light to this frame, point lights call this from their Render
+		static void Submit(const PointLightData& light);
+
+		//Lists every submitted light in the clusters of the main camera it reaches and uploads the lists
+		static void Build();
+
+		//Binds the three buffer textures to their units
+		static void Bind();
+
+		//The clusters only fit the main camera, offscreen passes with another camera turn point lights off
+		static void SetEnabled(bool newIsEnabled);
+
+		static size_t GetLightCount() { return lights.size(); }
+		static size_t GetIndexCount() { return indices.size(); }
+
+		static void Shutdown();
+	private:
+		static inline GLuint lightBuffer{};
+		static inline GLuint lightTexture{};
+		static inline GLuint rangeBuffer{};
+		static inline GLuint rangeTexture{};
+		static inline GLuint indexBuffer{};
+		static inline GLuint indexTexture{};
+
+		static inline GLint maxTexels{};
+		static inline bool isEnabled = true;
+		static inline bool isOverflowLogged = false;
+		static inline vec4 clusterDepth{};
+
+		static inline vector<PointLightData> lights{};
+
+		static inline vector<vec4> lightTexels{};
+		static inline vector<uint32_t> ranges{};  //first index and count of every cluster
+		static inline vector<uint32_t> indices{}; //light indices of every cluster back to back
+		static inline vector<uint32_t> bounds{};  //scratch, six cluster coordinates per light
+	};
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::uint32_t;
+	using std::shared_ptr;
+	using std::weak_ptr;
+	using std::string;
+	using std::unordered_map;
+	using std::vector;
+
+	struct MeshVertex
+	{
+		vec3 pos;       //location 0
+		vec3 normal;    //location 1
+		vec2 texCoords; //location 2
+	};
+
+	//Indexed geometry uploaded once into its own VAO, VBO and EBO.
+	//Owned through MeshHandle, the GL objects are deleted with the last handle.
+	class Mesh
+	{
+	public:
+		Mesh(
+			const string& name,
+			const vector<MeshVertex>& vertices,
+			const vector<uint32_t>& indices);
+
+		const string& GetName() const { return name; }
+		unsigned int GetVAO() const { return VAO; }
+		int GetIndexCount() const { return indexCount; }
+
+		Mesh(const Mesh&) = delete;
+		Mesh& operator=(const Mesh&) = delete;
+
+		~Mesh();
+	private:
+		string name{};
+
+		unsigned int VAO{};
+		unsigned int VBO{};
+		unsigned int EBO{};
+
+		int indexCount{};
+	};
+
+	using MeshHandle = shared_ptr<Mesh>;
+
+	//Hands out shared handles so every unique mesh is uploaded only once,
+	//no matter how many objects draw it
+	class MeshRegistry
+	{
+	public:
+		//Returns the live mesh with this name, or nullptr if no handle to it is left
+		static MeshHandle Find(const string& name);
+
+		//Uploads the mesh unless one with the same name is still alive
+		static MeshHandle Create(
+			const string& name,
+			const vector<MeshVertex>& vertices,
+			const vector<uint32_t>& indices);
+
+		//Unit cube centered on the origin, 24 vertices so every face keeps its own normal
+		static MeshHandle GetCube();
+	private:
+		//weak, so the registry never keeps an unused mesh alive
+		static inline unordered_map<string, weak_ptr<Mesh>> meshes{};
+	};
+}
\ No newline at end of file
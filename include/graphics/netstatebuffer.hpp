@@ -0,0 +1,44 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::uint32_t;
+	using std::vector;
+
+	//Texture unit the net states are bound to, programs read them through a usamplerBuffer
+	inline constexpr GLuint NET_STATE_TEXTURE_UNIT = 1;
+
+	//Every net state of the simulated board in one buffer texture of 32-bit words,
+	//net n is bit n % 32 of texel n / 32. Shaders look up the nets of their instances,
+	//so toggling signals never touches any geometry and a frame uploads one small buffer.
+	class NetStateBuffer
+	{
+	public:
+		static bool Initialize();
+
+		//Uploads the newest simulation snapshot if the states differ from the uploaded ones,
+		//returns true if they did
+		static bool Update();
+
+		//Binds the buffer texture to NET_STATE_TEXTURE_UNIT
+		static void Bind();
+
+		static void Shutdown();
+	private:
+		static inline GLuint buffer{};
+		static inline GLuint texture{};
+
+		static inline vector<uint32_t> uploadedStates{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <vector>
+
+//kalawindow
+#include "core/platform.hpp"
+
+#include "graphics/shaderprogram.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::vector;
+
+	struct OverlayVertex
+	{
+		vec2 pos;   //pixels, origin at the top left corner of the window
+		vec4 color;
+	};
+
+	//Immediate-mode 2D lines and rectangles drawn on top of the scene.
+	//Everything queued during a frame is uploaded in one buffer and drawn in two calls.
+	class Overlay
+	{
+	public:
+		static bool Initialize(ShaderProgram* shader);
+
+		static void AddLine(
+			const vec2& from,
+			const vec2& to,
+			const vec4& color);
+
+		static void AddRect(
+			const vec2& min,
+			const vec2& max,
+			const vec4& color);
+
+		//Uploads and draws everything queued this frame, then clears the queue.
+		//The view size comes from the shared camera uniforms.
+		static void Draw();
+
+		static void Shutdown();
+	private:
+		static inline ShaderProgram* overlayShader{};
+
+		static inline unsigned int VAO{};
+		static inline unsigned int VBO{};
+
+		static inline vector<OverlayVertex> triangleVertices{};
+		static inline vector<OverlayVertex> lineVertices{};
+	};
+}
\ No newline at end of file
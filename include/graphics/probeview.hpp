@@ -0,0 +1,31 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+//kalawindow
+#include "core/platform.hpp"
+
+#include "graphics/redrawtracker.hpp"
+
+namespace CircuitGame::Graphics
+{
+	//Logic analyzer overlay, one waveform row per attached probe
+	class ProbeView
+	{
+	public:
+		static bool IsVisible() { return isVisible; }
+		static void SetVisible(bool newVisible)
+		{
+			isVisible = newVisible;
+			RedrawTracker::Request(RedrawReason::ui);
+		}
+
+		//Decimates every probe to the pixel width of the view and queues its waveform into the overlay
+		static void Draw(const vec2& viewSize);
+	private:
+		static inline bool isVisible = false;
+	};
+}
\ No newline at end of file
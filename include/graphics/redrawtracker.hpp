@@ -0,0 +1,39 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+
+namespace CircuitGame::Graphics
+{
+	using std::uint8_t;
+
+	enum class RedrawReason : uint8_t
+	{
+		camera     = 1 << 0, //view or projection changed
+		scene      = 1 << 1, //objects were moved, added or removed, or the board was laid out again
+		simulation = 1 << 2, //the simulation published state that is on screen
+		ui         = 1 << 3  //overlays were toggled or the window became visible again
+	};
+
+	//Collects why the next frame has to be drawn. A frame is only drawn
+	//if something requested it, so a static board costs no rendering at all.
+	class RedrawTracker
+	{
+	public:
+		static void Request(RedrawReason reason) { pending |= static_cast<uint8_t>(reason); }
+
+		static bool IsPending() { return pending != 0; }
+
+		static bool IsPending(RedrawReason reason) { return (pending & static_cast<uint8_t>(reason)) != 0; }
+
+		//Called by the frame that draws everything requested so far
+		static void Clear() { pending = 0; }
+	private:
+		//the first frame is always drawn
+		static inline uint8_t pending = UINT8_MAX;
+	};
+}
\ No newline at end of file
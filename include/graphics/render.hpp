@@ -11,7 +11,12 @@
 #include <string>
 
 #include "gameobjects/cube.hpp"
+#include "gameobjects/pointlight.hpp"
+#include "gameobjects/dirlight.hpp"
 #include "graphics/texture.hpp"
+#include "graphics/shaderprogram.hpp"
+#include "graphics/instancebatch.hpp"
+#include "graphics/mesh.hpp"
 
 namespace CircuitGame::Graphics
 {
@@ -21,6 +26,8 @@ namespace CircuitGame::Graphics
 	using std::string;
 
 	using CircuitGame::GameObjects::Cube;
+	using CircuitGame::GameObjects::PointLight;
+	using CircuitGame::GameObjects::DirLight;
 	using CircuitGame::Graphics::Texture;
 
 	class Render
@@ -28,19 +35,33 @@ namespace CircuitGame::Graphics
 	public:
 		static inline unordered_map<string, unique_ptr<Texture>> createdTextures{};
 		static inline unordered_map<string, unique_ptr<Cube>> createdCubes{};
+		static inline unordered_map<string, unique_ptr<PointLight>> createdPointLights{};
+		static inline unordered_map<string, unique_ptr<DirLight>> createdDirLights{};
 
 		static inline vector<Texture*> runtimeTextures{};
 		static inline vector<Cube*> runtimeCubes{};
+		static inline vector<PointLight*> runtimePointLights{};
+		static inline vector<DirLight*> runtimeDirLights{};
+
+		static inline vector<unique_ptr<InstanceBatch>> frameBatches{};
 
 		//Initializes the render loop
 		static bool Initialize();
 
-		//The full graphical render loop of this program
-		static void Update();
+		//The full graphical render loop of this program.
+		//Draws a frame only if something requested a redraw, returns true if it did.
+		static bool Update();
 
 		//What to call when we need to redraw during rescaling the window etc
 		static void Redraw();
 
+		//Batch for objects re-queued every frame, created on first use.
+		//Gameobjects add themselves here from Render instead of drawing directly.
+		static InstanceBatch* GetFrameBatch(
+			const ShaderProgram* shader,
+			const Texture* texture,
+			const MeshHandle& mesh);
+
 		//Destroy all created textures and gameobjects
 		static void Shutdown();
 	};
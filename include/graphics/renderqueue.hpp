@@ -0,0 +1,84 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "graphics/instancebatch.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::vector;
+
+	enum class RenderPass : uint8_t
+	{
+		opaque,
+		transparent //after every opaque command, so blending sees the finished depth buffer
+	};
+
+	struct RenderCommand
+	{
+		uint64_t key;
+		InstanceBatch* batch;
+
+		//instances of batch this command draws
+		size_t first;
+		size_t count;
+	};
+
+	//Draw commands of one frame ordered by a 64-bit key. From the most significant bit:
+	//pass (4 bits), shader (20), texture (20), mesh (20).
+	//The key has no depth field: the camera looks straight down at the flat board,
+	//so every command sits at the same view depth and there is nothing to order by.
+	//Submitting in key order groups every command that shares a state,
+	//so each state only has to be bound once per group.
+	class RenderQueue
+	{
+	public:
+		//Shader, texture and mesh are GL object names.
+		//Names only order the commands, so names wider than their field merely sort less tightly.
+		static uint64_t MakeKey(
+			RenderPass pass,
+			uint32_t shaderID,
+			uint32_t textureID,
+			uint32_t meshID);
+
+		//Draws every instance of batch
+		void Add(
+			uint64_t key,
+			InstanceBatch* batch)
+		{
+			commands.push_back({ key, batch, 0, batch->GetInstanceCount() });
+		}
+
+		//Draws count instances of batch starting at first
+		void Add(
+			uint64_t key,
+			InstanceBatch* batch,
+			size_t first,
+			size_t count)
+		{
+			commands.push_back({ key, batch, first, count });
+		}
+
+		void Clear() { commands.clear(); }
+
+		//Stable LSD radix sort, 8 bits per pass. Passes where every key
+		//has the same byte are skipped, so unused key fields cost nothing.
+		void Sort();
+
+		const vector<RenderCommand>& GetCommands() const { return commands; }
+	private:
+		vector<RenderCommand> commands{};
+		vector<RenderCommand> scratch{};
+	};
+}
\ No newline at end of file
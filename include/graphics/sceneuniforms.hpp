@@ -0,0 +1,90 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+
+	//Uniform buffer binding points, the same for every program
+	inline constexpr GLuint CAMERA_BLOCK_BINDING = 0;
+	inline constexpr GLuint LIGHTS_BLOCK_BINDING = 1;
+
+	//The structs below mirror std140 uniform blocks, a vec3 takes 16 bytes
+	//unless a float follows it, so the padding members must stay where they are
+
+	//uniform Camera
+	struct CameraData
+	{
+		mat4 view;
+		mat4 projection;
+		vec4 position; //w unused
+		vec4 viewSize; //pixels in xy, their reciprocals in zw
+	};
+
+	struct DirLightData
+	{
+		vec3 direction;
+		float padding0;
+		vec3 intensity;
+		float padding1;
+
+		vec3 ambient;
+		float padding2;
+		vec3 diffuse;
+		float padding3;
+		vec3 specular;
+		float padding4;
+	};
+
+	//uniform Lights, point lights are read from the light clusters
+	struct LightsData
+	{
+		DirLightData dirLight;
+		vec4 clusterDepth; //near and far plane, slices per log unit of depth, 0 in w turns point lights off
+	};
+
+	static_assert(sizeof(CameraData) == 160);
+	static_assert(sizeof(DirLightData) == 80);
+	static_assert(sizeof(LightsData) == 96);
+
+	//Per-frame data every program shares through uniform buffers:
+	//uploaded once per frame instead of once per program, and never per object
+	class SceneUniforms
+	{
+	public:
+		static bool Initialize();
+
+		//Points the Camera and Lights blocks of program at the shared buffers,
+		//programs without those blocks are left alone
+		static void BindBlocks(GLuint program);
+
+		static void SetDirLight(const DirLightData& light);
+
+		//Depth slicing of the light clusters, the block is only uploaded again if it changed
+		static void SetClusterDepth(const vec4& depth);
+
+		//Copies the camera every frame and the lights only after they changed
+		static void Upload();
+
+		//Like Upload, but with a camera other than the main one, for offscreen passes
+		static void Upload(const CameraData& camera);
+
+		static void Shutdown();
+	private:
+		static inline GLuint cameraBuffer{};
+		static inline GLuint lightsBuffer{};
+
+		static inline LightsData lights{};
+		static inline bool isLightsDirty = true;
+	};
+}
\ No newline at end of file
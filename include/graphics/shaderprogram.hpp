@@ -0,0 +1,60 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "core/diskcache.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::unique_ptr;
+	using std::string;
+	using std::unordered_map;
+
+	using CircuitGame::Core::DiskCache;
+
+	//A linked vertex and fragment shader program.
+	//Linked programs are kept as driver binaries in a program cache, later launches
+	//restore them instead of compiling when the sources and the driver are unchanged.
+	class ShaderProgram
+	{
+	public:
+		static inline unordered_map<string, unique_ptr<ShaderProgram>> createdPrograms{};
+
+		//Enables the program cache in directory, requires a current context.
+		//Programs are always compiled if the driver cannot return program binaries.
+		static bool InitializeCache(const string& directory);
+
+		//Restores the program from the cache or compiles and links it and caches the binary.
+		//Returns nullptr and logs the compiler output if the sources do not compile or link.
+		static ShaderProgram* Create(
+			const string& programName,
+			const string& vertPath,
+			const string& fragPath);
+
+		const string& GetName() const { return name; }
+		GLuint GetProgramID() const { return programID; }
+
+		//Restored from the program cache instead of compiled
+		bool IsCached() const { return isCached; }
+
+		~ShaderProgram();
+	private:
+		static inline DiskCache cache{};
+		static inline string driver{}; //vendor, renderer and version, part of every cache key
+
+		string name{};
+		GLuint programID{};
+		bool isCached = false;
+	};
+}
\ No newline at end of file
@@ -7,13 +7,27 @@
 
 #include <string>
 
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
 namespace CircuitGame::Graphics
 {
 	using std::string;
 
+	//Where the pixels of a texture live inside its GL texture,
+	//the whole image for plain 2D textures, a packed rectangle for array sprites
+	struct TextureRegion
+	{
+		vec4 uvRect = vec4(0.0f, 0.0f, 1.0f, 1.0f); //offset in xy, scale in zw
+		float layer = 0.0f;
+	};
+
 	class Texture
 	{
 	public:
+		//Returns right away with the loader placeholder bound,
+		//the pixels are decoded in the background and swapped in once uploaded
 		static Texture* CreateTexture(
 			const string& textureName,
 			const string& texturePath);
@@ -21,9 +35,19 @@ namespace CircuitGame::Graphics
 		unsigned int GetTextureID() const { return textureID; }
 		const string& GetTexturePath() const { return texturePath; }
 
+		//GL_TEXTURE_2D, or GL_TEXTURE_2D_ARRAY for sprites of a texture array
+		GLenum GetTarget() const { return target; }
+		const TextureRegion& GetRegion() const { return region; }
+
 		~Texture();
 	private:
+		friend class TextureArray;
+		friend class TextureLoader;
+
 		unsigned int textureID{};
 		string texturePath{};
+
+		GLenum target = GL_TEXTURE_2D;
+		TextureRegion region{};
 	};
 }
\ No newline at end of file
@@ -0,0 +1,66 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/texture.hpp"
+#include "graphics/texturecache.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::uint32_t;
+	using std::string;
+	using std::vector;
+
+	struct SpriteSource
+	{
+		string textureName;
+		string texturePath;
+	};
+
+	//Packs many small images into the layers of one GL_TEXTURE_2D_ARRAY,
+	//so every sprite shares a single binding and instances pick theirs by layer and rectangle
+	class TextureArray
+	{
+	public:
+		//Registers every sprite in Render::createdTextures under its own name right away,
+		//they show the loader placeholder until the packed array has been uploaded.
+		//Layers are square, a power of two and at most maxLayerSize wide.
+		//Returns false and registers nothing if an image file is missing.
+		static bool Create(
+			const string& arrayName,
+			const vector<SpriteSource>& sprites,
+			uint32_t maxLayerSize = 2048,
+			uint32_t padding = 8);
+
+		//Decodes, packs and composes level 0 of every layer on the calling thread, touches no GL state.
+		//Returns false with the reason in error if an image cannot be decoded or does not fit a layer.
+		static bool Compose(
+			const vector<SpriteSource>& sprites,
+			uint32_t maxLayerSize,
+			uint32_t padding,
+			DecodedImage& out,
+			string& error);
+
+		//Mip levels an array with padding can have before neighbouring sprites start to blend,
+		//every level halves the padding
+		static uint32_t GetLevelCount(uint32_t padding);
+
+		//Creates the GL texture with storage for every level and layer of image, but no pixels yet
+		static GLuint Allocate(const DecodedImage& image);
+
+		//Deletes every created array, the sprite textures pointing at them must be destroyed too
+		static void Shutdown();
+	private:
+		static inline vector<GLuint> createdArrays{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "graphics/texture.hpp"
+#include "core/mappedfile.hpp"
+#include "core/diskcache.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::unique_ptr;
+	using std::string;
+	using std::vector;
+
+	using CircuitGame::Core::MappedFile;
+	using CircuitGame::Core::DiskCache;
+
+	//Decoded RGBA pixels of a 2D texture or texture array with its mip chain.
+	//Levels follow each other, every level holds all layers one after the other.
+	//The pixels live either in storage or in a mapped cache file.
+	struct DecodedImage
+	{
+		uint32_t width{};
+		uint32_t height{};
+		uint32_t layerCount = 1;
+		uint32_t levelCount = 1;
+
+		vector<TextureRegion> regions{}; //one per sprite of a texture array, empty for plain textures
+
+		const uint8_t* pixels{};
+
+		vector<uint8_t> storage{};
+		unique_ptr<MappedFile> file{};
+
+		uint32_t GetLevelWidth(uint32_t level) const
+		{
+			uint32_t levelWidth = width >> level;
+			return levelWidth > 0 ? levelWidth : 1;
+		}
+		uint32_t GetLevelHeight(uint32_t level) const
+		{
+			uint32_t levelHeight = height >> level;
+			return levelHeight > 0 ? levelHeight : 1;
+		}
+
+		//Bytes of one layer of level
+		size_t GetLayerSize(uint32_t level) const
+		{
+			return static_cast<size_t>(GetLevelWidth(level)) * GetLevelHeight(level) * 4;
+		}
+
+		const uint8_t* GetLayer(
+			uint32_t level,
+			uint32_t layer) const;
+
+		//Bytes of every level and layer together
+		size_t GetTotalSize() const;
+	};
+
+	//Keeps decoded, mipmapped images in a cache directory so later launches map them
+	//straight into memory instead of decoding the source images again.
+	//Blobs are named after their owner and a hash of the source file contents,
+	//so editing a source image gets it decoded again and its old blob removed.
+	//Everything but Initialize may run on any thread and never logs.
+	class TextureCache
+	{
+	public:
+		//Creates the cache directory, the cache stays disabled if that fails
+		static bool Initialize(const string& directory);
+
+		//Hashes the contents of every source file together with the settings
+		//that shape the decoded result, returns false if a file cannot be read.
+		//The decode of an unreadable source reports the problem, so no error is returned here.
+		static bool MakeKey(
+			const vector<string>& sourcePaths,
+			const string& settings,
+			uint64_t& key);
+
+		//Maps the blob of name and key into image, returns false if there is none or it is damaged.
+		//A blob that exists but cannot be mapped also fills error.
+		static bool Load(
+			const string& name,
+			uint64_t key,
+			DecodedImage& image,
+			string& error);
+
+		//Writes image as the blob of name and key and removes older blobs of name
+		static bool Store(
+			const string& name,
+			uint64_t key,
+			const DecodedImage& image,
+			string& error);
+
+		//Box-filters level 0 in storage down to levelCount levels
+		static void BuildMipmaps(
+			DecodedImage& image,
+			uint32_t levelCount);
+
+		//Levels down to 1x1 for an image of width and height
+		static uint32_t GetFullLevelCount(
+			uint32_t width,
+			uint32_t height);
+	private:
+		static inline DiskCache cache{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/texture.hpp"
+#include "graphics/texturearray.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::string;
+	using std::vector;
+
+	struct TextureLoadJob;
+
+	//Most pixel bytes uploaded per frame, at least one upload step always runs
+	inline constexpr size_t TEXTURE_UPLOAD_BUDGET = 8 * 1024 * 1024;
+
+	//Decodes images on a thread pool and streams them into GL through a pixel buffer object,
+	//a few megabytes per frame, so loading never stalls the render loop.
+	//Queued textures show a 1x1 white placeholder until their own pixels are swapped in.
+	class TextureLoader
+	{
+	public:
+		//Creates the placeholders and the staging buffer and starts the workers,
+		//requires a current context
+		static bool Initialize();
+
+		//Decodes texture->GetTexturePath() into a mipmapped 2D texture,
+		//textureName names its texture cache blob
+		static void QueueTexture(
+			const string& textureName,
+			Texture* texture);
+
+		//Composes the sprites into the layers of one texture array,
+		//textures holds the sprite textures in the same order as sprites.
+		//Both kinds of texture are mapped from the texture cache when it holds them.
+		static void QueueArray(
+			const string& arrayName,
+			const vector<Texture*>& textures,
+			const vector<SpriteSource>& sprites,
+			uint32_t maxLayerSize,
+			uint32_t padding);
+
+		//The texture shown while a texture of target is loading
+		static GLuint GetPlaceholder(GLenum target);
+
+		//Uploads finished decodes within the frame budget and swaps them in,
+		//call once per frame on the render thread
+		static void Update();
+
+		//Textures queued but not swapped in yet
+		static size_t GetPendingCount();
+
+		//Drops every pending load and deletes the placeholders and the staging buffer
+		static void Shutdown();
+	private:
+		//Runs one upload step of job, returns the bytes uploaded and sets isDone after the last step.
+		//A 2D step uploads as many rows of one mip level as fit into budget, at least one,
+		//an array step uploads every level of one layer.
+		static size_t UploadStep(
+			TextureLoadJob& job,
+			size_t budget,
+			bool& isDone);
+	};
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::string;
+	using std::unordered_map;
+
+	//Uniform locations of every linked program, resolved once instead of by name on every call.
+	//The setters write to the currently bound program, which must be program.
+	class UniformCache
+	{
+	public:
+		//Resolves every active uniform of a freshly linked program
+		//and connects its uniform blocks to the shared scene buffers
+		static void Register(GLuint program);
+
+		//Drops a deleted program, its name may be reused by the next link
+		static void Unregister(GLuint program);
+
+		//-1 if the program has no active uniform of that name,
+		//unknown programs (such as hot reloaded ones) are registered on first use
+		static GLint GetLocation(
+			GLuint program,
+			const string& name);
+
+		static void SetInt(GLuint program, const string& name, int value);
+		static void SetFloat(GLuint program, const string& name, float value);
+		static void SetVec2(GLuint program, const string& name, const vec2& value);
+		static void SetVec3(GLuint program, const string& name, const vec3& value);
+		static void SetVec4(GLuint program, const string& name, const vec4& value);
+		static void SetMat4(GLuint program, const string& name, const mat4& value);
+	private:
+		static inline unordered_map<GLuint, unordered_map<string, GLint>> programs{};
+	};
+}
\ No newline at end of file
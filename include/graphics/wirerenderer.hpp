@@ -0,0 +1,136 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+//glm
+#include "glm/glm.hpp"
+
+//kalawindow
+#include "core/platform.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/shaderprogram.hpp"
+#include "graphics/boxculler.hpp"
+#include "graphics/frustum.hpp"
+
+namespace CircuitGame::Graphics
+{
+	using std::size_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::unordered_map;
+	using std::vector;
+
+	using glm::ivec2;
+
+	//Cells along one side of a wire chunk
+	inline constexpr int WIRE_CHUNK_SIDE = 64;
+
+	//One straight piece of a wire clipped to a chunk, read by the vertex shader per instance
+	struct WireSegment
+	{
+		vec2 start; //location 1 xy, world units
+		vec2 end;   //location 1 zw
+		uint32_t net; //location 2, the net state buffer decides the color
+	};
+
+	struct Wire
+	{
+		vector<ivec2> points{};   //cells joined by straight segments
+		uint32_t net{};
+		vector<uint32_t> chunks{}; //chunks any segment passes through
+		bool isAlive{};
+	};
+
+	//Square block of cells with its own vertex buffer of the segments crossing it
+	struct WireChunk
+	{
+		ivec2 firstCell{};
+		vector<uint32_t> wires{};
+		GLuint vao{};
+		GLuint vbo{};
+		uint32_t segmentCount{};
+		bool isDirty{};
+	};
+
+	//Draws every wire of the board from static per-chunk vertex buffers.
+	//Editing a wire only marks the chunks it crosses, Update rebuilds just those,
+	//and every visible chunk is one instanced draw of screen-space quads,
+	//so lines keep the same pixel width at every zoom level.
+	class WireRenderer
+	{
+	public:
+		//cellSize is the world distance between two cell centers,
+		//height is the world z the wires are drawn at
+		static bool Initialize(
+			const ShaderProgram* shader,
+			float cellSize,
+			float height);
+
+		//Adds a wire through the centers of points, returns its handle
+		static uint32_t AddWire(
+			const vector<ivec2>& points,
+			uint32_t net);
+
+		static void RemoveWire(uint32_t wire);
+
+		//Removes every wire, the chunk buffers are kept for reuse
+		static void Clear();
+
+		static void SetLineWidth(float pixels) { lineWidth = pixels; }
+		static float GetLineWidth() { return lineWidth; }
+
+		//Rebuilds the vertex buffers of every chunk edited since the last call,
+		//returns true if any was rebuilt
+		static bool Update();
+
+		//Tests every chunk against frustum and keeps the visible ones that hold segments
+		static void Cull(const Frustum& frustum);
+
+		//Draws the chunks that passed the last Cull, one call each
+		static void Draw();
+
+		static size_t GetWireCount() { return wireCount; }
+		static size_t GetChunkCount() { return chunks.size(); }
+		static size_t GetVisibleChunkCount() { return visibleChunks.size(); }
+
+		static void Shutdown();
+	private:
+		//Returns the index of the chunk holding cell, creating it if needed
+		static uint32_t GetChunk(const ivec2& cell);
+
+		//Clips every live wire of the chunk to its cells and uploads the pieces
+		static void RebuildChunk(WireChunk& chunk);
+
+		static inline const ShaderProgram* shader{};
+		static inline float cellSize = 1.0f;
+		static inline float height{};
+		static inline float lineWidth = 2.0f;
+
+		//shared by every chunk, the two triangles of one segment quad
+		static inline GLuint cornerVBO{};
+
+		static inline vector<Wire> wires{};
+		static inline vector<uint32_t> freeWires{};
+		static inline vector<uint32_t> removedWires{}; //reused only after their chunks were rebuilt
+		static inline size_t wireCount{};
+
+		static inline vector<WireChunk> chunks{};
+		static inline unordered_map<uint64_t, uint32_t> chunkIndices{};
+		static inline vector<uint32_t> dirtyChunks{};
+		static inline BoxCuller chunkCuller{}; //indexed like chunks
+
+		static inline vector<uint32_t> culledChunks{};
+		static inline vector<uint32_t> visibleChunks{};
+
+		static inline vector<WireSegment> segments{}; //scratch for RebuildChunk
+	};
+}
\ No newline at end of file
@@ -0,0 +1,214 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "simulation/memory.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::unique_ptr;
+	using std::vector;
+
+	inline constexpr uint32_t NO_LOOP = UINT32_MAX;
+	inline constexpr uint32_t NO_NET = UINT32_MAX;
+
+	enum class GateType : uint8_t
+	{
+		buffer,
+		notGate,
+		andGate,
+		orGate,
+		xorGate,
+		nandGate,
+		norGate,
+		xnorGate,
+
+		//created by AddMemory, not through AddGate
+		memoryRead, //drives one data bit of the word at the address on its inputs
+		memoryWrite //writes on a rising clock edge, has no output net
+	};
+
+	struct Gate
+	{
+		GateType type{};
+		uint8_t bit{};         //data bit of a memoryRead gate
+		uint32_t firstInput{}; //index into the shared gate input list
+		uint32_t inputCount{};
+		uint32_t output{};     //net driven by this gate
+		uint32_t payload{};    //memory index of memory gates
+	};
+
+	//Nets connecting a memory to the board, bit 0 first in every list.
+	//A ROM leaves dataIn, writeEnable and clock unconnected.
+	struct MemoryPorts
+	{
+		vector<uint32_t> address{};
+		vector<uint32_t> dataIn{};
+		vector<uint32_t> dataOut{};
+		uint32_t writeEnable = NO_NET;
+		uint32_t clock = NO_NET;
+	};
+
+	//Square wave driving one net, every clock is its own clock domain
+	struct ClockSource
+	{
+		uint32_t net{};
+		uint64_t halfPeriod{}; //picoseconds between two edges
+		uint64_t phase{};      //picoseconds until the first edge
+	};
+
+	//The netlist of one board and its current signal state.
+	//Nets and gates are added while editing, Compile builds the flat fanout tables
+	//the event-driven evaluator walks. Only one thread may touch a board at a time.
+	class Board
+	{
+	public:
+		uint32_t AddNet();
+		uint32_t AddGate(
+			GateType type,
+			const vector<uint32_t>& inputs,
+			uint32_t output);
+
+		//Adds a clock source toggling net at frequency hertz, phase delays its first edge
+		uint32_t AddClock(
+			uint32_t net,
+			double frequency,
+			double phase = 0.0);
+
+		const vector<ClockSource>& GetClocks() const { return clocks; }
+
+		//Connects a RAM or ROM, reads are combinational and writes happen on
+		//the rising clock edge while writeEnable is high. Returns the memory index.
+		uint32_t AddMemory(
+			unique_ptr<Memory> memory,
+			const MemoryPorts& ports);
+
+		Memory* GetMemory(uint32_t index) const { return memories[index].memory.get(); }
+		uint32_t GetMemoryCount() const { return static_cast<uint32_t>(memories.size()); }
+
+		const Gate& GetGate(uint32_t index) const { return gates[index]; }
+
+		uint32_t GetGateInput(
+			const Gate& gate,
+			uint32_t input) const
+		{
+			return gateInputs[gate.firstInput + input];
+		}
+
+		uint32_t GetNetCount() const { return static_cast<uint32_t>(netStates.size()); }
+		uint32_t GetGateCount() const { return static_cast<uint32_t>(gates.size()); }
+
+		bool IsCompiled() const { return isCompiled; }
+
+		//Builds the fanout tables and finds combinational loops,
+		//must be called after editing and before stepping
+		bool Compile();
+
+		//Strongly connected gate groups found by the last Compile, latches included
+		uint32_t GetLoopCount() const { return static_cast<uint32_t>(loopOffsets.size() - 1); }
+		uint32_t GetGateLoop(uint32_t gate) const { return gateLoop[gate]; }
+
+		//Delta cycles one Step may take before the still-switching loops are isolated
+		uint32_t GetDeltaCycleBudget() const { return deltaCycleBudget; }
+		void SetDeltaCycleBudget(uint32_t newBudget) { deltaCycleBudget = newBudget; }
+
+		//Nets frozen because their loop did not settle within the delta cycle budget
+		const vector<uint32_t>& GetOscillatingNets() const { return oscillatingNets; }
+		uint32_t GetIsolatedGateCount() const { return isolatedGateCount; }
+
+		//Re-enables all isolated gates, they are evaluated again on the next Step
+		void ClearIsolation();
+
+		bool GetNetState(uint32_t net) const { return netStates[net] != 0; }
+
+		//Packs every net state into bits, net n is bit n % 32 of word n / 32
+		void PackNetStates(vector<uint32_t>& bits) const;
+
+		//Drives a net from outside the netlist (clocks, switches),
+		//the change is propagated on the next Step
+		void SetNetState(uint32_t net, bool state);
+
+		//Gate evaluations done by Step since the board was created
+		uint64_t GetEvaluationCount() const { return evaluationCount; }
+
+		//Evaluates pending gates in delta cycles until the board settles
+		//or the delta cycle budget runs out. Returns the number of delta cycles taken.
+		uint32_t Step();
+	private:
+		bool EvaluateGate(const Gate& gate) const;
+		void ScheduleGate(uint32_t gateIndex);
+		void ScheduleFanout(uint32_t net);
+
+		//Commits a memory write on a rising clock edge and wakes the read gates of that memory
+		void EvaluateMemoryWrite(const Gate& gate);
+
+		//Tarjan's algorithm over the gate graph, iterative so deep chains cannot overflow the stack.
+		//Returns all gates in topological order of their components.
+		vector<uint32_t> FindLoops();
+
+		//Freezes every loop that still has pending gates after the budget ran out.
+		//Returns false if no loop gate is pending, the board is then only deeper
+		//than the budget and is guaranteed to settle. isForced freezes every pending gate instead,
+		//for when the step ran longer than any loop-free logic could.
+		//Never logs, Step runs on the simulation thread, the simulator reports the new counts instead.
+		bool IsolateOscillation(bool isForced);
+
+		bool isCompiled = false;
+
+		uint32_t deltaCycleBudget = 1000;
+
+		uint64_t evaluationCount{};
+
+		vector<uint8_t> netStates{};
+
+		vector<Gate> gates{};
+		vector<uint32_t> gateInputs{};
+
+		vector<ClockSource> clocks{};
+
+		struct MemoryBinding
+		{
+			unique_ptr<Memory> memory{};
+			uint32_t addressWidth{};
+			uint32_t dataWidth{};
+			uint32_t firstReadGate{};
+			uint8_t lastClock{};
+		};
+		vector<MemoryBinding> memories{};
+
+		//gates reading net n are fanoutGates[fanoutOffsets[n] .. fanoutOffsets[n + 1]]
+		vector<uint32_t> fanoutOffsets{};
+		vector<uint32_t> fanoutGates{};
+
+		//gates of loop l are loopGates[loopOffsets[l] .. loopOffsets[l + 1]]
+		vector<uint32_t> gateLoop{};
+		vector<uint32_t> loopOffsets{ 0 };
+		vector<uint32_t> loopGates{};
+
+		vector<uint8_t> isGateIsolated{};
+		vector<uint8_t> isNetOscillating{};
+		vector<uint32_t> oscillatingNets{};
+		uint32_t isolatedGateCount{};
+
+		vector<uint32_t> pendingGates{};
+		vector<uint32_t> evaluatingGates{};
+		vector<uint8_t> isGateQueued{};
+
+		struct NetChange
+		{
+			uint32_t net;
+			uint8_t state;
+		};
+		vector<NetChange> netChanges{};
+	};
+}
\ No newline at end of file
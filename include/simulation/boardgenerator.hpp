@@ -0,0 +1,100 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "simulation/board.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::string;
+	using std::vector;
+
+	enum class StressBoard : uint8_t
+	{
+		rippleAdder,     //two size-bit operands and their sum
+		arrayMultiplier, //size x size bit AND array with ripple-carry rows
+		lfsrBank,        //size free-running LFSRs built from master-slave flip-flops
+		randomDag,       //size random gates, fan-out follows the chosen distribution
+		gateGrid         //size gates in a square grid, each reading its left and upper neighbour
+	};
+
+	enum class FanoutDistribution : uint8_t
+	{
+		fixed,     //every net feeds fanoutMean gates
+		geometric, //mostly small, occasionally large fan-out
+		powerLaw   //a few nets drive a large share of the board, like clock and reset trees
+	};
+
+	struct GeneratorSettings
+	{
+		StressBoard type = StressBoard::gateGrid;
+
+		//bit width for adders and multipliers, register count for LFSR banks,
+		//gate count for random DAGs and grids
+		uint32_t size = 1024;
+
+		uint32_t lfsrWidth = 16; //3 to 32 bits
+
+		FanoutDistribution fanout = FanoutDistribution::geometric;
+		double fanoutMean = 2.0; //random DAGs only
+		uint32_t dagDepth = 64;  //gate levels of random DAGs
+
+		//primary inputs are driven by clocks of frequency, frequency / 2, frequency / 4 and so on,
+		//activity is the share of primary inputs that get a clock at all
+		double frequency = 1000.0;
+		double activity = 1.0;
+
+		uint64_t seed = 1;
+	};
+
+	//Builds synthetic boards of a known shape and size,
+	//the standard inputs every simulation and rendering benchmark is measured against
+	class BoardGenerator
+	{
+	public:
+		//Appends the requested circuit to board, returns false if the settings are invalid
+		static bool Generate(
+			Board& board,
+			const GeneratorSettings& settings);
+
+		//Reads --board, --size, --lfsr-width, --fanout, --fanout-mean, --depth,
+		//--frequency, --activity and --seed, unknown arguments are left for the caller.
+		//Returns false and logs the problem if a value is missing or invalid.
+		static bool ParseArguments(
+			const vector<string>& arguments,
+			GeneratorSettings& settings);
+
+		//True if any argument read by ParseArguments was given, any of them asks for a stress board
+		static bool HasArguments(const vector<string>& arguments);
+
+		static string GetUsage();
+
+		static string ToString(StressBoard type);
+	private:
+		static void AddRippleAdder(
+			Board& board,
+			const GeneratorSettings& settings);
+		static void AddArrayMultiplier(
+			Board& board,
+			const GeneratorSettings& settings);
+		static void AddLfsrBank(
+			Board& board,
+			const GeneratorSettings& settings);
+		static void AddRandomDag(
+			Board& board,
+			const GeneratorSettings& settings);
+		static void AddGateGrid(
+			Board& board,
+			const GeneratorSettings& settings);
+	};
+}
@@ -0,0 +1,112 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "core/mappedfile.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::size_t;
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::unique_ptr;
+	using std::string;
+	using std::vector;
+
+	using CircuitGame::Core::MappedFile;
+
+	inline constexpr size_t MEMORY_PAGE_SIZE = 4096;
+
+	//Word-addressed RAM or ROM backed by lazily allocated 4 KiB pages.
+	//Pages that were never written read as zero and take no memory,
+	//a ROM reads its pages straight out of the memory-mapped image file.
+	class Memory
+	{
+	public:
+		//Creates a zeroed RAM with wordCount words of dataWidth bits (1 to 32)
+		static unique_ptr<Memory> CreateRam(
+			const string& name,
+			uint32_t wordCount,
+			uint32_t dataWidth);
+
+		//Maps a raw little-endian image file as ROM, the word count follows the file size
+		static unique_ptr<Memory> CreateRom(
+			const string& name,
+			const string& imagePath,
+			uint32_t dataWidth);
+
+		const string& GetName() const { return name; }
+		uint32_t GetWordCount() const { return wordCount; }
+		uint32_t GetDataWidth() const { return dataWidth; }
+		bool IsReadOnly() const { return isReadOnly; }
+
+		//Pages that own their storage, mapped ROM pages are not counted
+		size_t GetAllocatedPageCount() const { return allocatedPageCount; }
+
+		//Out of range addresses read as zero
+		uint32_t Read(uint32_t address) const
+		{
+			if (address >= wordCount) return 0;
+
+			size_t byte = static_cast<size_t>(address) * wordBytes;
+			const uint8_t* page = pages[byte / MEMORY_PAGE_SIZE];
+			if (page == nullptr) return 0;
+
+			const uint8_t* word = page + byte % MEMORY_PAGE_SIZE;
+
+			uint32_t value = 0;
+			for (uint32_t i = 0; i < wordBytes; i++)
+			{
+				value |= static_cast<uint32_t>(word[i]) << (i * 8);
+			}
+			return value & dataMask;
+		}
+
+		//Ignored for ROM and out of range addresses
+		void Write(uint32_t address, uint32_t value);
+
+		//Copies raw little-endian words into RAM starting at word address offset,
+		//all-zero source pages are skipped so they stay unallocated
+		bool Load(
+			const uint8_t* data,
+			size_t size,
+			uint32_t offset = 0);
+
+		//Bulk loads an image file into RAM through a temporary mapping
+		bool LoadImage(
+			const string& imagePath,
+			uint32_t offset = 0);
+	private:
+		//Sets up the page table without allocating any page
+		static unique_ptr<Memory> Allocate(
+			const string& name,
+			uint32_t wordCount,
+			uint32_t dataWidth);
+
+		uint8_t* GetWritablePage(size_t pageIndex);
+
+		string name{};
+
+		uint32_t wordCount{};
+		uint32_t dataWidth{};
+		uint32_t wordBytes{}; //1, 2 or 4 so words never straddle a page
+		uint32_t dataMask{};
+
+		bool isReadOnly = false;
+
+		vector<const uint8_t*> pages{};            //read view, nullptr reads as zero
+		vector<unique_ptr<uint8_t[]>> ownedPages{}; //storage of allocated pages
+		size_t allocatedPageCount{};
+
+		unique_ptr<MappedFile> image{};
+	};
+}
\ No newline at end of file
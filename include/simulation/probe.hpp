@@ -0,0 +1,100 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "core/spscring.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::atomic;
+	using std::uint8_t;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::vector;
+
+	using CircuitGame::Core::SpscRing;
+
+	//Per-pixel summary of a decimated probe trace
+	enum class ProbeLevel : uint8_t
+	{
+		low,
+		high,
+		toggling //both levels were seen inside this pixel column
+	};
+
+	//Logic analyzer probe attached to one net.
+	//The simulation thread samples the net once per Simulator::GetProbeSamplePeriod of simulated time,
+	//so every sample covers the same span whichever clock domains have edges in between.
+	//Samples are packed one bit each into 64-bit words and full words are pushed through a
+	//single-producer/single-consumer ring, the render thread drains the ring once per frame
+	//into a fixed-size history.
+	class Probe
+	{
+	public:
+		Probe(uint32_t net, size_t historySamples);
+
+		uint32_t GetNet() const { return net; }
+
+		//Words the simulation produced while the ring was full
+		uint64_t GetDroppedWords() const { return droppedWords.load(std::memory_order_relaxed); }
+
+		//Steps the ring holds before the simulation starts dropping words
+		uint64_t GetRingSamples() const { return static_cast<uint64_t>(ring.GetCapacity()) * 64; }
+
+		//Simulation thread only, appends count samples of the same level
+		void Sample(
+			bool state,
+			uint64_t count)
+		{
+			uint64_t level = state ? ~0ULL : 0ULL;
+
+			while (count > 0)
+			{
+				uint64_t bitCount = 64 - pendingBits;
+				if (count < bitCount) bitCount = count;
+
+				uint64_t mask = bitCount == 64
+					? ~0ULL
+					: ((1ULL << bitCount) - 1) << pendingBits;
+
+				pendingWord |= level & mask;
+				pendingBits += static_cast<uint32_t>(bitCount);
+				count -= bitCount;
+
+				if (pendingBits == 64) Flush();
+			}
+		}
+
+		//Render thread only, moves all produced words into the history,
+		//returns true if there were any
+		bool Drain();
+
+		//Render thread only, summarizes the newest history samples into pixelWidth columns
+		void Decimate(
+			size_t pixelWidth,
+			vector<ProbeLevel>& out) const;
+	private:
+		void Flush();
+
+		uint32_t net{};
+
+		//simulation thread state
+		uint64_t pendingWord{};
+		uint32_t pendingBits{};
+
+		SpscRing<uint64_t> ring;
+		atomic<uint64_t> droppedWords{};
+
+		//render thread state, circular buffer of words, oldest at historyStart
+		vector<uint64_t> history{};
+		size_t historyStart{};
+		size_t historyCount{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "simulation/board.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::vector;
+	using std::priority_queue;
+
+	inline constexpr uint64_t NO_EDGE = UINT64_MAX;
+
+	//Orders the clock domains of a board by their next edge.
+	//Simulated time jumps straight from one due edge to the next, so a slow
+	//domain is only touched when it actually toggles, no matter how fast the
+	//fastest clock on the board is.
+	class ClockScheduler
+	{
+	public:
+		//Schedules the first edge of every clock relative to startTime (picoseconds)
+		void Reset(
+			const vector<ClockSource>& newClocks,
+			uint64_t startTime);
+
+		//Time of the earliest pending edge, NO_EDGE if the board has no clocks
+		uint64_t GetNextEdgeTime() const { return edges.empty() ? NO_EDGE : edges.top().time; }
+
+		//Removes every edge due at exactly the next edge time, appends the nets
+		//they toggle to dueNets and reschedules each clock one half period later.
+		//Returns the time of the popped edges.
+		uint64_t PopDueEdges(vector<uint32_t>& dueNets);
+	private:
+		struct Edge
+		{
+			uint64_t time;
+			uint32_t clock;
+		};
+
+		//priority_queue keeps the largest on top, so this orders by the earliest edge,
+		//ties broken by clock index to keep runs deterministic
+		struct IsLater
+		{
+			bool operator()(const Edge& a, const Edge& b) const
+			{
+				return a.time != b.time
+					? a.time > b.time
+					: a.clock > b.clock;
+			}
+		};
+
+		vector<ClockSource> clocks{};
+		priority_queue<Edge, vector<Edge>, IsLater> edges{};
+	};
+}
\ No newline at end of file
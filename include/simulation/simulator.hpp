@@ -0,0 +1,116 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "simulation/board.hpp"
+#include "simulation/probe.hpp"
+#include "simulation/scheduler.hpp"
+#include "core/triplebuffer.hpp"
+
+namespace CircuitGame::Simulation
+{
+	using std::atomic;
+	using std::uint32_t;
+	using std::uint64_t;
+	using std::unique_ptr;
+	using std::thread;
+	using std::vector;
+	using std::chrono::nanoseconds;
+
+	using CircuitGame::Core::TripleBuffer;
+
+	class Simulator
+	{
+	public:
+		static inline Board board{};
+
+		static inline vector<unique_ptr<Probe>> probes{};
+
+		//Compiles the board, schedules its clocks and starts the simulation thread
+		static bool Initialize();
+
+		//Simulated seconds per real second, 1.0 runs every clock at its real frequency
+		static void SetTimeScale(double newTimeScale);
+		static double GetTimeScale() { return timeScale; }
+
+		//Simulated time in picoseconds
+		static uint64_t GetSimulatedTime() { return simulatedTime.load(std::memory_order_relaxed); }
+
+		//Time points evaluated so far, each one is a set of clock edges followed by a board step
+		static uint64_t GetStepCount() { return stepCount.load(std::memory_order_relaxed); }
+
+		static bool IsRunning() { return isRunning.load(); }
+
+		//Gates and nets isolated by the board so far, published with every net state snapshot
+		//so the render thread can report new isolations, the simulation thread never logs them
+		static uint32_t GetIsolatedGateCount() { return isolatedGateCount.load(std::memory_order_relaxed); }
+		static uint32_t GetOscillatingNetCount() { return oscillatingNetCount.load(std::memory_order_relaxed); }
+
+		static void Start();
+		static void Stop();
+
+		//Probes can be attached and detached at any time,
+		//the simulation thread is paused while the probe list changes
+		static Probe* AttachProbe(uint32_t net);
+		static void DetachProbe(Probe* probe);
+
+		//Render thread, moves new probe samples into their histories, call once per frame.
+		//Returns true if any probe received samples.
+		static bool DrainProbes();
+
+		//Simulated picoseconds between two probe samples, half the shortest clock half period,
+		//so the fastest clock shows two samples per level and every trace shares one time axis
+		static uint64_t GetProbeSamplePeriod() { return probeSamplePeriod; }
+
+		//Longest wall time the render thread may go between two DrainProbes calls before the
+		//probe rings overflow, nanoseconds::max() without probes or clocks
+		static nanoseconds GetDrainInterval() { return drainInterval; }
+
+		//Render thread. Returns every net state packed by Board::PackNetStates if the simulation
+		//published newer ones since the last call, nullptr otherwise
+		static const vector<uint32_t>* TakeNetStates();
+
+		//Compiles the board and steps it on the calling thread as fast as possible
+		//for the given wall time, then logs steps, gate evaluations and simulated time per second
+		static bool RunBenchmark(double seconds);
+
+		//Stops the simulation thread and destroys all probes
+		static void Shutdown();
+	private:
+		static void Run();
+
+		//Packs the board into the back slot of netStates and publishes it,
+		//only called by whichever thread currently owns the board
+		static void PublishNetStates();
+
+		//Picks the probe sample period for the current clocks and measures the drain interval
+		//for it, the probes and the time scale, only called while the simulation thread is stopped
+		static void UpdateProbeSampling();
+
+		static inline double timeScale = 1.0;
+		static inline uint64_t probeSamplePeriod = 1;
+		static inline nanoseconds drainInterval = nanoseconds::max();
+
+		static inline ClockScheduler scheduler{};
+
+		static inline atomic<bool> isRunning{};
+		static inline atomic<uint64_t> simulatedTime{};
+		static inline atomic<uint64_t> stepCount{};
+		static inline atomic<uint32_t> isolatedGateCount{};
+		static inline atomic<uint32_t> oscillatingNetCount{};
+
+		static inline thread simulationThread{};
+
+		static inline TripleBuffer<vector<uint32_t>> netStates{};
+	};
+}
\ No newline at end of file
@@ -0,0 +1,176 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "core/diskcache.hpp"
+#include "core/mappedfile.hpp"
+
+using CircuitGame::Core::DiskCache;
+using CircuitGame::Core::BlobPart;
+using CircuitGame::Core::MappedFile;
+
+using std::filesystem::create_directories;
+using std::filesystem::directory_iterator;
+using std::filesystem::exists;
+using std::filesystem::path;
+using std::filesystem::remove;
+using std::filesystem::rename;
+using std::error_code;
+using std::ofstream;
+using std::ios;
+using std::streamsize;
+using std::unique_ptr;
+using std::string;
+using std::vector;
+
+namespace CircuitGame::Core
+{
+	bool DiskCache::Initialize(
+		const string& newDirectory,
+		const string& newExtension,
+		string& error)
+	{
+		error_code createError{};
+		create_directories(newDirectory, createError);
+
+		if (createError)
+		{
+			error = createError.message();
+			isEnabled = false;
+			return false;
+		}
+
+		directory = newDirectory;
+		extension = newExtension;
+		isEnabled = true;
+
+		return true;
+	}
+
+	unique_ptr<MappedFile> DiskCache::Map(
+		const string& name,
+		uint64_t key,
+		string& error) const
+	{
+		if (!isEnabled) return nullptr;
+
+		//a missing blob is a plain cache miss, not an error
+		string blobPath = GetPath(name, key);
+		if (!exists(blobPath)) return nullptr;
+
+		return MappedFile::Open(blobPath, error);
+	}
+
+	bool DiskCache::Write(
+		const string& name,
+		uint64_t key,
+		const vector<BlobPart>& parts,
+		string& error) const
+	{
+		if (!isEnabled) return true;
+
+		string blobPath = GetPath(name, key);
+		string tempPath = blobPath + ".tmp";
+
+		{
+			ofstream out(tempPath, ios::binary | ios::trunc);
+			if (!out.is_open())
+			{
+				error = "cache file '" + tempPath + "' could not be created";
+				return false;
+			}
+
+			for (const auto& part : parts)
+			{
+				out.write(static_cast<const char*>(part.data), static_cast<streamsize>(part.size));
+			}
+
+			if (!out.good())
+			{
+				out.close();
+
+				error_code ignored{};
+				remove(tempPath, ignored);
+
+				error = "cache file '" + tempPath + "' could not be written";
+				return false;
+			}
+		}
+
+		error_code renameError{};
+		rename(tempPath, blobPath, renameError);
+		if (renameError)
+		{
+			error_code ignored{};
+			remove(tempPath, ignored);
+
+			error = "cache file '" + blobPath + "' could not be replaced, " + renameError.message();
+			return false;
+		}
+
+		//blobs of earlier keys are never needed again
+		string blobName = path(blobPath).filename().string();
+
+		error_code iterateError{};
+		for (const auto& entry : directory_iterator(directory, iterateError))
+		{
+			string entryName = entry.path().filename().string();
+			if (entryName != blobName
+				&& IsBlobOf(entryName, name))
+			{
+				error_code ignored{};
+				remove(entry.path(), ignored);
+			}
+		}
+
+		return true;
+	}
+
+	string DiskCache::GetPath(
+		const string& name,
+		uint64_t key) const
+	{
+		static const char digits[] = "0123456789abcdef";
+
+		string hex(16, '0');
+		for (size_t i = 0; i < 16; i++)
+		{
+			hex[15 - i] = digits[(key >> (i * 4)) & 0xF];
+		}
+
+		return (path(directory) / (name + "." + hex + extension)).string();
+	}
+
+	bool DiskCache::IsBlobOf(
+		const string& fileName,
+		const string& name) const
+	{
+		//a bare prefix match would also take the blobs of 'name.other'
+		if (fileName.size() != name.size() + 1 + 16 + extension.size()
+			|| fileName.compare(0, name.size(), name) != 0
+			|| fileName[name.size()] != '.'
+			|| fileName.compare(fileName.size() - extension.size(), extension.size(), extension) != 0)
+		{
+			return false;
+		}
+
+		for (size_t i = name.size() + 1; i < name.size() + 1 + 16; i++)
+		{
+			char c = fileName[i];
+			bool isHex = (c >= '0' && c <= '9')
+				|| (c >= 'a' && c <= 'f');
+
+			if (!isHex) return false;
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,158 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#ifdef _WIN32
+#include <windows.h>
+#include <timeapi.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "core/framepacer.hpp"
+
+using CircuitGame::Core::FramePacer;
+
+using std::max;
+using std::min;
+using std::this_thread::sleep_for;
+using std::this_thread::yield;
+using std::chrono::duration;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::chrono::time_point;
+
+//Sleeps measured by Calibrate and the length of each
+static constexpr int CALIBRATION_SLEEPS = 16;
+static constexpr milliseconds CALIBRATION_SLEEP = milliseconds(1);
+
+//Spun on top of the largest overshoot seen, and never less than this in total
+static constexpr nanoseconds SLACK_MARGIN = microseconds(200);
+static constexpr nanoseconds MIN_SLACK = microseconds(500);
+
+//Share of the gap to a smaller overshoot the slack gives up per sleep
+static constexpr int SLACK_DECAY = 64;
+
+//At most this share of a frame is spun, the rest is always slept, however large the slack grew
+static constexpr int MAX_SPIN_SHARE = 2;
+
+namespace CircuitGame::Core
+{
+	void FramePacer::Calibrate()
+	{
+#ifdef _WIN32
+		//the default 15.6 ms tick would leave a high cap with nothing but spinning
+		if (!hasTimerPeriod) hasTimerPeriod = timeBeginPeriod(1) == TIMERR_NOERROR;
+#endif
+
+		sleepSlack = MIN_SLACK;
+
+		for (int i = 0; i < CALIBRATION_SLEEPS; i++)
+		{
+			time_point<steady_clock> before = steady_clock::now();
+			sleep_for(CALIBRATION_SLEEP);
+
+			UpdateSlack(steady_clock::now() - before - CALIBRATION_SLEEP);
+		}
+	}
+
+	void FramePacer::Shutdown()
+	{
+#ifdef _WIN32
+		if (hasTimerPeriod) timeEndPeriod(1);
+#endif
+		hasTimerPeriod = false;
+	}
+
+	void FramePacer::SetTargetRate(double hz)
+	{
+		targetRate = hz > 0.0 ? hz : 0.0;
+		targetFrameTime = targetRate > 0.0
+			? duration_cast<nanoseconds>(duration<double>(1.0 / targetRate))
+			: nanoseconds(0);
+
+		isOnTimeline = false;
+	}
+
+	void FramePacer::WaitForNextFrame()
+	{
+		if (targetFrameTime.count() == 0) return;
+
+		time_point<steady_clock> now = steady_clock::now();
+
+		//the first paced frame has no deadline yet, it opens the timeline
+		if (!isOnTimeline)
+		{
+			deadline = now + targetFrameTime;
+			isOnTimeline = true;
+			return;
+		}
+
+		pacedCount++;
+
+		if (now > deadline)
+		{
+			missedCount++;
+
+			//a whole frame late, catching up would only burst frames out
+			if (now - deadline > targetFrameTime)
+			{
+				deadline = now + targetFrameTime;
+				return;
+			}
+		}
+		else WaitUntil(deadline);
+
+		//from the deadline rather than from the wake up, so late wake ups do not add up
+		deadline += targetFrameTime;
+	}
+
+	void FramePacer::WaitIdle(nanoseconds idleTime)
+	{
+		isOnTimeline = false;
+		if (idleTime.count() <= 0) return;
+
+		sleep_for(idleTime);
+	}
+
+	void FramePacer::WaitUntil(time_point<steady_clock> waitDeadline)
+	{
+		nanoseconds remaining = waitDeadline - steady_clock::now();
+
+		//a slack of a whole frame would never let a wait sleep again and spin a core for good
+		nanoseconds slack = targetFrameTime.count() > 0
+			? min(sleepSlack, targetFrameTime / MAX_SPIN_SHARE)
+			: sleepSlack;
+
+		if (remaining > slack)
+		{
+			nanoseconds sleepTime = remaining - slack;
+
+			time_point<steady_clock> before = steady_clock::now();
+			sleep_for(sleepTime);
+
+			UpdateSlack(steady_clock::now() - before - sleepTime);
+		}
+		else UpdateSlack(nanoseconds(0));
+
+		//only the last sliver of the frame, yielding lets other threads have the core
+		while (steady_clock::now() < waitDeadline)
+		{
+			yield();
+		}
+	}
+
+	void FramePacer::UpdateSlack(nanoseconds overshoot)
+	{
+		nanoseconds needed = max(overshoot + SLACK_MARGIN, MIN_SLACK);
+
+		if (needed > sleepSlack) sleepSlack = needed;
+		else sleepSlack -= (sleepSlack - needed) / SLACK_DECAY;
+	}
+}
\ No newline at end of file
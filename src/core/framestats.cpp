@@ -0,0 +1,250 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "core/framestats.hpp"
+
+using CircuitGame::Core::FrameStats;
+using CircuitGame::Core::FrameStatsSummary;
+using CircuitGame::Core::FRAME_STATS_SUB_BITS;
+using CircuitGame::Core::FRAME_STATS_SUB_COUNT;
+using CircuitGame::Core::FRAME_STATS_MAX_US;
+using CircuitGame::Core::FRAME_STATS_BUCKETS;
+
+using std::bit_width;
+using std::ceil;
+using std::min;
+using std::ofstream;
+using std::snprintf;
+using std::string;
+using std::to_string;
+using std::chrono::duration_cast;
+using std::chrono::microseconds;
+
+static constexpr uint64_t HALF_SUB_COUNT = FRAME_STATS_SUB_COUNT / 2;
+
+//A frame this many times slower than the recent average is a hitch,
+//if it also took longer than HITCH_MIN_US, so fast frames jittering by a millisecond do not count
+static constexpr double HITCH_FACTOR = 2.0;
+static constexpr uint64_t HITCH_MIN_US = 10'000;
+
+//Weight of the newest frame in the recent average
+static constexpr double AVERAGE_WEIGHT = 0.05;
+
+//Writes ms with three decimals
+static string FormatMs(double ms);
+
+namespace CircuitGame::Core
+{
+	void FrameStats::EndIteration(bool isDrawn)
+	{
+		time_point<steady_clock> now = steady_clock::now();
+
+		if (isDrawn)
+		{
+			if (wasDrawn) Record(duration_cast<microseconds>(now - lastDrawTime).count());
+			lastDrawTime = now;
+		}
+
+		wasDrawn = isDrawn;
+	}
+
+	void FrameStats::Record(uint64_t us)
+	{
+		counts[GetBucket(us)]++;
+		frameCount++;
+		totalUs += us;
+		if (us > maxUs) maxUs = us;
+
+		if (averageUs > 0.0
+			&& us > HITCH_MIN_US
+			&& static_cast<double>(us) > averageUs * HITCH_FACTOR)
+		{
+			hitchCount++;
+		}
+
+		averageUs = averageUs > 0.0
+			? averageUs + (static_cast<double>(us) - averageUs) * AVERAGE_WEIGHT
+			: static_cast<double>(us);
+	}
+
+	FrameStatsSummary FrameStats::GetSummary()
+	{
+		FrameStatsSummary summary{};
+		summary.frameCount = frameCount;
+		summary.hitchCount = hitchCount;
+		if (frameCount == 0) return summary;
+
+		summary.meanMs = static_cast<double>(totalUs) / static_cast<double>(frameCount) / 1000.0;
+		summary.p50Ms = GetPercentileMs(50.0);
+		summary.p95Ms = GetPercentileMs(95.0);
+		summary.p99Ms = GetPercentileMs(99.0);
+		summary.maxMs = static_cast<double>(maxUs) / 1000.0;
+		summary.onePercentLowFps = summary.p99Ms > 0.0 ? 1000.0 / summary.p99Ms : 0.0;
+
+		return summary;
+	}
+
+	double FrameStats::GetPercentileMs(double percentile)
+	{
+		if (frameCount == 0) return 0.0;
+
+		//rank of the frame the percentile falls on, counting from 1
+		uint64_t rank = static_cast<uint64_t>(ceil(percentile / 100.0 * static_cast<double>(frameCount)));
+		if (rank < 1) rank = 1;
+
+		uint64_t seen = 0;
+		for (size_t bucket = 0; bucket < FRAME_STATS_BUCKETS; bucket++)
+		{
+			seen += counts[bucket];
+			if (seen < rank) continue;
+
+			//never past the slowest frame actually seen
+			return static_cast<double>(min(GetBucketHigh(bucket), maxUs)) / 1000.0;
+		}
+
+		return static_cast<double>(maxUs) / 1000.0;
+	}
+
+	bool FrameStats::Dump(
+		const string& basePath,
+		string& error)
+	{
+		FrameStatsSummary summary = GetSummary();
+
+		ofstream json(basePath + ".json", std::ios::trunc);
+		if (!json)
+		{
+			error = "'" + basePath + ".json' could not be opened for writing";
+			return false;
+		}
+
+		json << "{\n"
+			<< "\t\"frames\": " << summary.frameCount << ",\n"
+			<< "\t\"hitches\": " << summary.hitchCount << ",\n"
+			<< "\t\"meanMs\": " << FormatMs(summary.meanMs) << ",\n"
+			<< "\t\"p50Ms\": " << FormatMs(summary.p50Ms) << ",\n"
+			<< "\t\"p95Ms\": " << FormatMs(summary.p95Ms) << ",\n"
+			<< "\t\"p99Ms\": " << FormatMs(summary.p99Ms) << ",\n"
+			<< "\t\"maxMs\": " << FormatMs(summary.maxMs) << ",\n"
+			<< "\t\"onePercentLowFps\": " << FormatMs(summary.onePercentLowFps) << ",\n"
+			<< "\t\"buckets\": [";
+
+		ofstream csv(basePath + ".csv", std::ios::trunc);
+		if (!csv)
+		{
+			error = "'" + basePath + ".csv' could not be opened for writing";
+			return false;
+		}
+
+		csv << "low_ms,high_ms,count,cumulative_percent\n";
+
+		uint64_t seen = 0;
+		bool isFirst = true;
+		for (size_t bucket = 0; bucket < FRAME_STATS_BUCKETS; bucket++)
+		{
+			if (counts[bucket] == 0) continue;
+
+			seen += counts[bucket];
+
+			string low = FormatMs(static_cast<double>(GetBucketLow(bucket)) / 1000.0);
+			string high = FormatMs(static_cast<double>(GetBucketHigh(bucket)) / 1000.0);
+			string cumulative = FormatMs(100.0 * static_cast<double>(seen) / static_cast<double>(frameCount));
+
+			json << (isFirst ? "\n" : ",\n")
+				<< "\t\t{ \"lowMs\": " << low
+				<< ", \"highMs\": " << high
+				<< ", \"count\": " << counts[bucket] << " }";
+			isFirst = false;
+
+			csv << low << "," << high << "," << counts[bucket] << "," << cumulative << "\n";
+		}
+
+		json << (isFirst ? "]\n}\n" : "\n\t]\n}\n");
+
+		json.close();
+		csv.close();
+		if (!json
+			|| !csv)
+		{
+			error = "'" + basePath + "' could not be written";
+			return false;
+		}
+
+		return true;
+	}
+
+	string FrameStats::ToString()
+	{
+		FrameStatsSummary summary = GetSummary();
+
+		return to_string(summary.frameCount) + " frames"
+			+ ", p50 " + FormatMs(summary.p50Ms) + " ms"
+			+ ", p95 " + FormatMs(summary.p95Ms) + " ms"
+			+ ", p99 " + FormatMs(summary.p99Ms) + " ms"
+			+ ", max " + FormatMs(summary.maxMs) + " ms"
+			+ ", 1% low " + FormatMs(summary.onePercentLowFps) + " fps"
+			+ ", " + to_string(summary.hitchCount) + " hitches";
+	}
+
+	void FrameStats::Reset()
+	{
+		counts = {};
+		frameCount = 0;
+		totalUs = 0;
+		maxUs = 0;
+		hitchCount = 0;
+		averageUs = 0.0;
+		wasDrawn = false;
+	}
+
+	size_t FrameStats::GetBucket(uint64_t us)
+	{
+		us = min(us, FRAME_STATS_MAX_US);
+		if (us < FRAME_STATS_SUB_COUNT) return static_cast<size_t>(us);
+
+		//past the first octave the top SUB_BITS - 1 bits below the leading one pick the bucket
+		uint64_t shift = static_cast<uint64_t>(bit_width(us)) - FRAME_STATS_SUB_BITS;
+		uint64_t top = us >> shift;
+
+		return static_cast<size_t>(FRAME_STATS_SUB_COUNT + (shift - 1) * HALF_SUB_COUNT + (top - HALF_SUB_COUNT));
+	}
+
+	uint64_t FrameStats::GetBucketLow(size_t bucket)
+	{
+		if (bucket < FRAME_STATS_SUB_COUNT) return bucket;
+
+		uint64_t offset = bucket - FRAME_STATS_SUB_COUNT;
+		uint64_t shift = offset / HALF_SUB_COUNT + 1;
+		uint64_t top = offset % HALF_SUB_COUNT + HALF_SUB_COUNT;
+
+		return top << shift;
+	}
+
+	uint64_t FrameStats::GetBucketHigh(size_t bucket)
+	{
+		if (bucket < FRAME_STATS_SUB_COUNT) return bucket;
+
+		uint64_t offset = bucket - FRAME_STATS_SUB_COUNT;
+		uint64_t shift = offset / HALF_SUB_COUNT + 1;
+		uint64_t top = offset % HALF_SUB_COUNT + HALF_SUB_COUNT;
+
+		return ((top + 1) << shift) - 1;
+	}
+}
+
+string FormatMs(double ms)
+{
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.3f", ms);
+
+	return string(buffer);
+}
\ No newline at end of file
@@ -8,6 +8,11 @@
 #include <memory>
 #include <string>
 #include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <vector>
+#include <filesystem>
 
 //kalacrashhandler
 #include "crashHandler.hpp"
@@ -20,8 +25,18 @@
 #include "core/core.hpp"
 
 #include "core/gamecore.hpp"
+#include "core/trace.hpp"
+#include "core/framestats.hpp"
+#include "core/framepacer.hpp"
+#include "core/windowevents.hpp"
 #include "graphics/render.hpp"
 #include "graphics/texture.hpp"
+#include "graphics/probeview.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/frameprofiler.hpp"
+#include "simulation/simulator.hpp"
+#include "simulation/boardgenerator.hpp"
 
 //kalacrashhandler
 using KalaKit::KalaCrashHandler;
@@ -33,20 +48,35 @@ using KalaWindow::Graphics::Window;
 using KalaWindow::Graphics::WindowState;
 using KalaWindow::Core::Input;
 using KalaWindow::Core::Key;
+using KalaWindow::Core::MouseButton;
 using KalaWindow::Core::Logger;
 using KalaWindow::Core::LogType;
 using GLVState = KalaWindow::Graphics::OpenGL::VSyncState;
 using KalaWindow::Graphics::OpenGL::Renderer_OpenGL;
 
 using CircuitGame::Core::Game;
+using CircuitGame::Core::Trace;
+using CircuitGame::Core::FrameStats;
+using CircuitGame::Core::FrameStatsSummary;
+using CircuitGame::Core::FramePacer;
+using CircuitGame::Core::WindowEvents;
 using CircuitGame::Graphics::Render;
 using CircuitGame::Graphics::Texture;
+using CircuitGame::Graphics::ProbeView;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::GLStateCounters;
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::FrameProfiler;
+using CircuitGame::Graphics::CpuScope;
+using CircuitGame::Simulation::Simulator;
+using CircuitGame::Simulation::GateType;
+using CircuitGame::Simulation::BoardGenerator;
+using CircuitGame::Simulation::GeneratorSettings;
 
 using std::thread;
 using std::chrono::milliseconds;
-using std::this_thread::sleep_for;
+using std::chrono::nanoseconds;
 using std::chrono::steady_clock;
-using dur = std::chrono::steady_clock::duration;
 using std::chrono::time_point;
 using std::chrono::duration;
 using std::unique_ptr;
@@ -54,19 +84,41 @@ using std::make_unique;
 using std::string;
 using std::to_string;
 using std::stringstream;
+using std::vector;
+using std::find;
+using std::min;
+using std::filesystem::path;
+using std::filesystem::current_path;
 
 static inline bool isInitialized = false;
 static inline bool isRunning = false;
 
-static inline unsigned int activeSleep{};
-static inline unsigned int idleSleep{};
+//Time between input checks while nothing on screen changes
+static constexpr milliseconds UNCHANGED_SLEEP = milliseconds(10);
+
+//Longest block on window events while the window is hidden or unfocused,
+//shorter when the simulation fills the probe rings sooner
+static constexpr milliseconds IDLE_EVENT_WAIT = milliseconds(500);
+
+//Frame rate caps the cap key cycles through, 0 leaves pacing to vsync
+static constexpr double FRAME_CAPS[] = { 0.0, 60.0, 144.0, 240.0 };
+static size_t frameCapIndex = 0;
 
 static bool canSleep = true;
 
 static bool isDisplayingTitleData = false;
 static void DisplayTitleData();
 
-static void SleepFor(unsigned int ms);
+//Moves to the next frame rate cap, or to the given rate if it is positive
+static void SetFrameCap(double hz = 0.0);
+
+static void CreateDemoBoard();
+
+//Starts a trace capture, or stops the running one and writes it to the working directory
+static void ToggleTraceCapture();
+
+//Logs the frame time percentiles and writes them to the working directory
+static void DumpFrameStats();
 
 static Window* mainWindow{};
 
@@ -74,14 +126,68 @@ static vec2 lastSize{};
 
 namespace CircuitGame::Core
 {
-	void Game::Initialize()
+	void Game::Initialize(const vector<string>& arguments)
 	{
+		auto hasArgument = [&arguments](const string& name)
+			{
+				return find(arguments.begin(), arguments.end(), name) != arguments.end();
+			};
+
+		if (hasArgument("--help"))
+		{
+			Logger::Print(
+				"usage: CircuitGame [--headless] [--seconds N] [--fps-cap HZ] [stress board arguments]\n"
+				+ BoardGenerator::GetUsage(),
+				"TEST_PROJECT",
+				LogType::LOG_INFO);
+
+			return;
+		}
+
+		GeneratorSettings generatorSettings{};
+		if (!BoardGenerator::ParseArguments(arguments, generatorSettings)) return;
+
+		double frameCap = 0.0;
+		auto frameCapArgument = find(arguments.begin(), arguments.end(), "--fps-cap");
+		if (frameCapArgument != arguments.end()
+			&& frameCapArgument + 1 != arguments.end())
+		{
+			//anything unparsable leaves the frame rate uncapped
+			frameCap = strtod((frameCapArgument + 1)->c_str(), nullptr);
+		}
+
+		bool isHeadless = hasArgument("--headless");
+		//--size and the other settings alone generate the default stress board rather than being dropped
+		bool isStressBoard = isHeadless || BoardGenerator::HasArguments(arguments);
+
+		//headless runs only benchmark the simulation, nothing below needs a window
+		if (isHeadless)
+		{
+			double seconds = 10.0;
+
+			auto secondsArgument = find(arguments.begin(), arguments.end(), "--seconds");
+			if (secondsArgument != arguments.end()
+				&& secondsArgument + 1 != arguments.end())
+			{
+				//anything unparsable keeps the default
+				double value = strtod((secondsArgument + 1)->c_str(), nullptr);
+				if (value > 0.0) seconds = value;
+			}
+
+			if (!BoardGenerator::Generate(Simulator::board, generatorSettings)) return;
+			Simulator::RunBenchmark(seconds);
+
+			return;
+		}
+
+		TRACE_THREAD_NAME("main");
+
 		KalaCrashHandler::SetShutdownCallback(Shutdown_Crash);
 		KalaCrashHandler::SetProgramName("CircuitGame");
 
 		KalaCrashHandler::Initialize();
 
-		KalaWindowCore::SetUserShutdownFunction(Render::Shutdown);
+		KalaWindowCore::SetUserShutdownFunction(Shutdown);
 
 		string title = "CircuitGame";
 		float width = 800;
@@ -103,6 +209,17 @@ namespace CircuitGame::Core
 		if (!Render::Initialize()) return;
 		Renderer_OpenGL::SetVSyncState(GLVState::VSYNC_ON);
 
+		FramePacer::Calibrate();
+		if (frameCap > 0.0) SetFrameCap(frameCap);
+
+		if (isStressBoard)
+		{
+			if (!BoardGenerator::Generate(Simulator::board, generatorSettings)) return;
+		}
+		else CreateDemoBoard();
+
+		if (!Simulator::Initialize()) return;
+
 		mainWindow->SetMinSize(vec2{ 800, 600 });
 		mainWindow->SetMaxSize(vec2{ 3840, 2160 });
 
@@ -111,8 +228,15 @@ namespace CircuitGame::Core
 			<< "1: set vsync on\n"
 			<< "2: set vsync off\n"
 			<< "3: set vsync to triple buffering (vulkan only)\n"
-			<< "4: toggle sleep\n"
+			<< "4: toggle sleep and frame pacing\n"
 			<< "5: toggle fps and resolution in title\n"
+			<< "6: toggle probe overlay\n"
+			<< "7: toggle frame profiler\n"
+			<< "8: start or stop a trace capture to trace.json\n"
+			<< "9: write frame time percentiles to framestats.json and framestats.csv\n"
+			<< "0: cycle the frame rate cap, use it with vsync off\n"
+			<< "right mouse drag: pan the board\n"
+			<< "mouse wheel: zoom\n"
 			<< "====================";
 
 		Logger::Print(
@@ -132,7 +256,15 @@ namespace CircuitGame::Core
 	{
 		while (isRunning)
 		{
+			TRACE_ZONE("Game::Update");
+
+			FrameProfiler::BeginFrame();
+
+			FrameProfiler::BeginCpu(CpuScope::windowUpdate);
 			mainWindow->Update();
+			FrameProfiler::EndCpu(CpuScope::windowUpdate);
+
+			FrameProfiler::BeginCpu(CpuScope::input);
 
 			if (Input::IsKeyPressed(Key::Num1))
 			{
@@ -199,18 +331,88 @@ namespace CircuitGame::Core
 					LogType::LOG_DEBUG);
 			}
 
-			Render::Update();
+			if (Input::IsKeyPressed(Key::Num6))
+			{
+				ProbeView::SetVisible(!ProbeView::IsVisible());
+
+				string newProbeViewState = ProbeView::IsVisible()
+					? "Enabled 'probe overlay'"
+					: "Disabled 'probe overlay'";
+
+				Logger::Print(
+					newProbeViewState,
+					"TEST_PROJECT",
+					LogType::LOG_DEBUG);
+			}
+
+			if (Input::IsKeyPressed(Key::Num7))
+			{
+				FrameProfiler::SetVisible(!FrameProfiler::IsVisible());
+
+				string newProfilerState = FrameProfiler::IsVisible()
+					? "Enabled 'frame profiler'"
+					: "Disabled 'frame profiler'";
+
+				Logger::Print(
+					newProfilerState,
+					"TEST_PROJECT",
+					LogType::LOG_DEBUG);
+			}
+
+			if (Input::IsKeyPressed(Key::Num8)) ToggleTraceCapture();
+			if (Input::IsKeyPressed(Key::Num9)) DumpFrameStats();
+			if (Input::IsKeyPressed(Key::Num0)) SetFrameCap();
+
+			if (Input::IsMouseDown(MouseButton::Right))
+			{
+				Camera::Pan(Input::GetMouseDelta());
+			}
+			Camera::Zoom(Input::GetMouseWheelDelta());
+
+			FrameProfiler::EndCpu(CpuScope::input);
+
+			bool isDrawn = Render::Update();
+			FrameStats::EndIteration(isDrawn);
 
 			Input::EndFrameUpdate();
 
-			unsigned int sleepTime = mainWindow->IsIdle() ? idleSleep : activeSleep;
-			SleepFor(sleepTime);
+			if (canSleep)
+			{
+				//without a frame there is no swap to block on, so wait for input instead of spinning
+				if (isDrawn) FramePacer::WaitForNextFrame();
+				else if (mainWindow->IsIdle())
+				{
+					//nothing is drawn until the window is shown or focused again, so sleep until the OS
+					//reports an event, waking only in time for the next frame to drain the probe rings
+					nanoseconds timeout = min<nanoseconds>(IDLE_EVENT_WAIT, Simulator::GetDrainInterval() / 2);
+
+					FramePacer::ResetTimeline();
+					WindowEvents::WaitFor(mainWindow, timeout);
+				}
+				else FramePacer::WaitIdle(UNCHANGED_SLEEP);
+			}
+
+			FrameProfiler::EndFrame();
 		}
 	}
 
+	void Game::Shutdown()
+	{
+		//a capture still running on exit is kept
+		if (Trace::IsCapturing()) ToggleTraceCapture();
+
+		if (isInitialized) DumpFrameStats();
+
+		Simulator::Shutdown();
+		Render::Shutdown();
+		FramePacer::Shutdown();
+	}
+
 	void Game::Shutdown_Crash()
 	{
+		Simulator::Shutdown();
 		Render::Shutdown();
+		FramePacer::Shutdown();
 
 		KalaWindowCore::Shutdown(
 			ShutdownState::SHUTDOWN_CRITICAL,
@@ -218,17 +420,113 @@ namespace CircuitGame::Core
 	}
 }
 
-void SleepFor(unsigned int ms)
+void SetFrameCap(double hz)
+{
+	if (hz > 0.0) FramePacer::SetTargetRate(hz);
+	else
+	{
+		frameCapIndex = (frameCapIndex + 1) % (sizeof(FRAME_CAPS) / sizeof(FRAME_CAPS[0]));
+		FramePacer::SetTargetRate(FRAME_CAPS[frameCapIndex]);
+	}
+
+	string newFrameCap = FramePacer::GetTargetRate() > 0.0
+		? "Set 'frame rate cap' to '" + to_string(static_cast<int>(FramePacer::GetTargetRate())) + " Hz'"
+		: "Disabled 'frame rate cap'";
+
+	Logger::Print(
+		newFrameCap,
+		"TEST_PROJECT",
+		LogType::LOG_DEBUG);
+}
+
+void ToggleTraceCapture()
+{
+	if (!Trace::IsCompiledIn())
+	{
+		Logger::Print(
+			"Cannot capture a trace because this build was configured without CIRCUITGAME_TRACE!",
+			"TEST_PROJECT",
+			LogType::LOG_WARNING);
+
+		return;
+	}
+
+	if (!Trace::IsCapturing())
+	{
+		Trace::StartCapture();
+
+		Logger::Print(
+			"Started trace capture",
+			"TEST_PROJECT",
+			LogType::LOG_DEBUG);
+
+		return;
+	}
+
+	string tracePath = path(current_path() / "trace.json").string();
+	string error{};
+	if (!Trace::StopCapture(tracePath, error))
+	{
+		Logger::Print(
+			"Failed to write trace '" + tracePath + "' because " + error + "!",
+			"TEST_PROJECT",
+			LogType::LOG_ERROR,
+			2);
+
+		return;
+	}
+
+	Logger::Print(
+		"Wrote trace '" + tracePath + "', open it in chrome://tracing or Perfetto",
+		"TEST_PROJECT",
+		LogType::LOG_SUCCESS);
+}
+
+void DumpFrameStats()
 {
-	if (!canSleep) return;
+	Logger::Print(
+		"Frame times: " + FrameStats::ToString(),
+		"TEST_PROJECT",
+		LogType::LOG_INFO);
+
+	string basePath = path(current_path() / "framestats").string();
+	string error{};
+	if (!FrameStats::Dump(basePath, error))
+	{
+		Logger::Print(
+			"Failed to write frame statistics because " + error + "!",
+			"TEST_PROJECT",
+			LogType::LOG_ERROR,
+			2);
 
-	milliseconds convertedMS = milliseconds(ms);
+		return;
+	}
 
-	time_point<steady_clock> now = steady_clock::now();
-	dur frameDuration = now - Game::lastFrameTime;
+	Logger::Print(
+		"Wrote frame statistics to '" + basePath + ".json' and '" + basePath + ".csv'",
+		"TEST_PROJECT",
+		LogType::LOG_SUCCESS);
+}
+
+void CreateDemoBoard()
+{
+	//1 MHz clock, its inverse and a copy gated by a 1 Hz blinker, each with a probe attached
+	auto& board = Simulator::board;
 
-	if (frameDuration < convertedMS) sleep_for(convertedMS - frameDuration);
-	Game::lastFrameTime = steady_clock::now();
+	uint32_t clock = board.AddNet();
+	uint32_t inverted = board.AddNet();
+	uint32_t blinker = board.AddNet();
+	uint32_t gated = board.AddNet();
+
+	board.AddGate(GateType::notGate, { clock }, inverted);
+	board.AddGate(GateType::andGate, { clock, blinker }, gated);
+
+	board.AddClock(clock, 1'000'000.0);
+	board.AddClock(blinker, 1.0);
+
+	Simulator::AttachProbe(clock);
+	Simulator::AttachProbe(inverted);
+	Simulator::AttachProbe(gated);
 }
 
 void DisplayTitleData()
@@ -274,7 +572,23 @@ void DisplayTitleData()
 			to_string(static_cast<int>(lastSize.x)) + "x" +
 			to_string(static_cast<int>(lastSize.y));
 
-		string title = "CircuitGame [ " + resolution + " ] [ " + fpsStr + " fps ]";
+		//state changes of the last frame that reached the driver and that the state cache skipped
+		const GLStateCounters& binds = GLState::GetLastFrameCounters();
+		string bindStr =
+			to_string(binds.issued) + " binds, " +
+			to_string(binds.skipped) + " skipped";
+
+		//the average above hides stutter, the slowest percent of frames shows it
+		FrameStatsSummary frameStats = FrameStats::GetSummary();
+		string lowStr = to_string(static_cast<int>(frameStats.onePercentLowFps)) + " fps 1% low, "
+			+ to_string(frameStats.hitchCount) + " hitches";
+
+		string capStr = FramePacer::GetTargetRate() > 0.0
+			? " [ " + to_string(static_cast<int>(FramePacer::GetTargetRate())) + " Hz cap, "
+				+ to_string(FramePacer::GetMissedCount()) + " missed ]"
+			: "";
+
+		string title = "CircuitGame [ " + resolution + " ] [ " + fpsStr + " fps ] [ " + lowStr + " ]" + capStr + " [ " + bindStr + " ]";
 		mainWindow->SetTitle(title);
 
 		frameCount = 0;
@@ -0,0 +1,167 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#ifdef _WIN32
+#include <windows.h>
+#elif __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <memory>
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "core/mappedfile.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Core::MappedFile;
+
+using std::unique_ptr;
+using std::make_unique;
+using std::string;
+
+namespace CircuitGame::Core
+{
+	unique_ptr<MappedFile> MappedFile::Open(const string& filePath)
+	{
+		string error{};
+		unique_ptr<MappedFile> file = Open(filePath, error);
+
+		if (file == nullptr)
+		{
+			Logger::Print(
+				"Failed to map a file because " + error + "!",
+				"MAPPED_FILE",
+				LogType::LOG_ERROR,
+				2);
+		}
+
+		return file;
+	}
+
+	unique_ptr<MappedFile> MappedFile::Open(
+		const string& filePath,
+		string& error)
+	{
+		unique_ptr<MappedFile> file = make_unique<MappedFile>();
+		file->path = filePath;
+
+#ifdef _WIN32
+		HANDLE fileHandle = CreateFileA(
+			filePath.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL,
+			nullptr);
+
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			error = "file '" + filePath + "' could not be opened";
+			return nullptr;
+		}
+		file->fileHandle = reinterpret_cast<uintptr_t>(fileHandle);
+
+		//the handle is already owned by file, returning nullptr closes it
+		LARGE_INTEGER fileSize{};
+		if (!GetFileSizeEx(fileHandle, &fileSize))
+		{
+			error = "size of file '" + filePath + "' could not be read";
+			return nullptr;
+		}
+		file->size = static_cast<size_t>(fileSize.QuadPart);
+
+		//empty files cannot be mapped, but they are still valid files
+		if (file->size == 0) return file;
+
+		HANDLE mappingHandle = CreateFileMappingA(
+			fileHandle,
+			nullptr,
+			PAGE_READONLY,
+			0,
+			0,
+			nullptr);
+
+		if (mappingHandle == nullptr)
+		{
+			error = "no file mapping could be created for '" + filePath + "'";
+			return nullptr;
+		}
+		file->mappingHandle = reinterpret_cast<uintptr_t>(mappingHandle);
+
+		void* view = MapViewOfFile(
+			mappingHandle,
+			FILE_MAP_READ,
+			0,
+			0,
+			0);
+
+		if (view == nullptr)
+		{
+			error = "no view of '" + filePath + "' could be mapped";
+			return nullptr;
+		}
+		file->data = static_cast<const uint8_t*>(view);
+#elif __linux__
+		int fd = open(filePath.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			error = "file '" + filePath + "' could not be opened";
+			return nullptr;
+		}
+		file->fileHandle = static_cast<uintptr_t>(fd);
+
+		//the descriptor is already owned by file, returning nullptr closes it
+		struct stat fileStat{};
+		if (fstat(fd, &fileStat) != 0)
+		{
+			error = "size of file '" + filePath + "' could not be read";
+			return nullptr;
+		}
+		file->size = static_cast<size_t>(fileStat.st_size);
+
+		//empty files cannot be mapped, but they are still valid files
+		if (file->size == 0) return file;
+
+		void* view = mmap(
+			nullptr,
+			file->size,
+			PROT_READ,
+			MAP_PRIVATE,
+			fd,
+			0);
+
+		if (view == MAP_FAILED)
+		{
+			error = "file '" + filePath + "' could not be mapped";
+			return nullptr;
+		}
+		file->data = static_cast<const uint8_t*>(view);
+#endif
+
+		return file;
+	}
+
+	MappedFile::~MappedFile()
+	{
+#ifdef _WIN32
+		if (data) UnmapViewOfFile(data);
+		if (mappingHandle) CloseHandle(reinterpret_cast<HANDLE>(mappingHandle));
+		if (fileHandle != UINTPTR_MAX) CloseHandle(reinterpret_cast<HANDLE>(fileHandle));
+#elif __linux__
+		if (data) munmap(const_cast<uint8_t*>(data), size);
+		if (fileHandle != UINTPTR_MAX) close(static_cast<int>(fileHandle));
+#endif
+	}
+}
\ No newline at end of file
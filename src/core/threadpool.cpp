@@ -0,0 +1,93 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "core/threadpool.hpp"
+#include "core/trace.hpp"
+
+using CircuitGame::Core::ThreadPool;
+
+using std::max;
+using std::move;
+using std::function;
+using std::lock_guard;
+using std::unique_lock;
+using std::mutex;
+using std::thread;
+
+namespace CircuitGame::Core
+{
+	void ThreadPool::Start(size_t threadCount)
+	{
+		if (!workers.empty()) return;
+
+		if (threadCount == 0)
+		{
+			//the main thread stays busy with input and rendering
+			size_t hardwareThreads = thread::hardware_concurrency();
+			threadCount = max<size_t>(hardwareThreads, 2) - 1;
+		}
+
+		{
+			lock_guard<mutex> lock(jobMutex);
+			isStopping = false;
+		}
+
+		for (size_t i = 0; i < threadCount; i++)
+		{
+			workers.emplace_back(&ThreadPool::Run, this);
+		}
+	}
+
+	void ThreadPool::Submit(function<void()> job)
+	{
+		{
+			lock_guard<mutex> lock(jobMutex);
+			jobs.push_back(move(job));
+		}
+		jobReady.notify_one();
+	}
+
+	void ThreadPool::Stop()
+	{
+		{
+			lock_guard<mutex> lock(jobMutex);
+			isStopping = true;
+			jobs.clear();
+		}
+		jobReady.notify_all();
+
+		for (auto& worker : workers)
+		{
+			if (worker.joinable()) worker.join();
+		}
+		workers.clear();
+	}
+
+	void ThreadPool::Run()
+	{
+		TRACE_THREAD_NAME("pool worker");
+
+		while (true)
+		{
+			function<void()> job{};
+			{
+				unique_lock<mutex> lock(jobMutex);
+				jobReady.wait(lock, [this]() { return isStopping || !jobs.empty(); });
+
+				if (isStopping) return;
+
+				job = move(jobs.front());
+				jobs.pop_front();
+			}
+
+			job();
+		}
+	}
+}
\ No newline at end of file
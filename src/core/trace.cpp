@@ -0,0 +1,254 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include "core/trace.hpp"
+
+#ifdef CIRCUITGAME_TRACE
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+
+using CircuitGame::Core::Trace;
+using CircuitGame::Core::TraceBuffer;
+using CircuitGame::Core::TraceEvent;
+using CircuitGame::Core::TraceEventType;
+using CircuitGame::Core::TRACE_EVENTS_PER_THREAD;
+
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+using std::lock_guard;
+using std::make_unique;
+using std::memory_order_acquire;
+using std::memory_order_relaxed;
+using std::memory_order_release;
+using std::ofstream;
+using std::snprintf;
+using std::string;
+
+static thread_local TraceBuffer* threadBuffer{};
+
+//Quotes and escapes text as a JSON string
+static string ToJsonString(const char* text);
+
+//Nanoseconds as the microseconds the trace format counts in
+static string ToMicroseconds(int64_t ns);
+
+namespace CircuitGame::Core
+{
+	void Trace::StartCapture()
+	{
+		captureStart = Now();
+
+		//threads empty their buffers themselves once they see the new generation
+		generation.fetch_add(1, memory_order_release);
+		isCapturing.store(true, memory_order_release);
+	}
+
+	bool Trace::StopCapture(
+		const string& path,
+		string& error)
+	{
+		isCapturing.store(false, memory_order_release);
+
+		ofstream file(path, std::ios::trunc);
+		if (!file)
+		{
+			error = "it could not be opened for writing";
+			return false;
+		}
+
+		uint32_t currentGeneration = generation.load(memory_order_acquire);
+
+		file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+		file << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"CircuitGame\"}}";
+
+		lock_guard<mutex> lock(registryMutex);
+
+		for (const auto& buffer : buffers)
+		{
+			string tid = std::to_string(buffer->threadID);
+
+			if (!buffer->threadName.empty())
+			{
+				file << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+					<< ",\"args\":{\"name\":" << ToJsonString(buffer->threadName.c_str()) << "}}";
+			}
+
+			//a thread that recorded nothing since the capture started still holds an older one
+			if (buffer->generation.load(memory_order_acquire) != currentGeneration) continue;
+
+			//events below the count are never written again during this capture
+			size_t count = buffer->count.load(memory_order_acquire);
+			for (size_t i = 0; i < count; i++)
+			{
+				const TraceEvent& event = buffer->events[i];
+
+				//zones still open when the capture started
+				if (event.start < captureStart) continue;
+
+				file << ",\n{\"name\":" << ToJsonString(event.name)
+					<< ",\"pid\":1,\"tid\":" << tid
+					<< ",\"ts\":" << ToMicroseconds(event.start - captureStart);
+
+				if (event.type == TraceEventType::zone)
+				{
+					file << ",\"ph\":\"X\",\"dur\":" << ToMicroseconds(event.duration) << "}";
+				}
+				else
+				{
+					char value[32];
+					snprintf(value, sizeof(value), "%.17g", event.value);
+					file << ",\"ph\":\"C\",\"args\":{\"value\":" << value << "}}";
+				}
+			}
+
+			size_t dropped = buffer->dropped.load(memory_order_relaxed);
+			if (dropped > 0)
+			{
+				file << ",\n{\"name\":\"events dropped, buffer full\",\"ph\":\"i\",\"s\":\"t\",\"pid\":1,\"tid\":" << tid
+					<< ",\"ts\":" << ToMicroseconds(Now() - captureStart)
+					<< ",\"args\":{\"count\":" << dropped << "}}";
+			}
+		}
+
+		file << "\n]}\n";
+		file.close();
+
+		if (!file)
+		{
+			error = "it could not be written";
+			return false;
+		}
+
+		return true;
+	}
+
+	void Trace::SetThreadName(const char* name)
+	{
+		TraceBuffer* buffer = GetBuffer(false);
+
+		lock_guard<mutex> lock(registryMutex);
+		buffer->threadName = name;
+	}
+
+	void Trace::Counter(
+		const char* name,
+		double value)
+	{
+		if (!IsCapturing()) return;
+
+		TraceEvent event =
+		{
+			.name = name,
+			.start = Now(),
+			.duration = 0,
+			.value = value,
+			.type = TraceEventType::counter
+		};
+		Append(event);
+	}
+
+	void Trace::Zone(
+		const char* name,
+		int64_t start,
+		int64_t end)
+	{
+		TraceEvent event =
+		{
+			.name = name,
+			.start = start,
+			.duration = end - start,
+			.value = 0.0,
+			.type = TraceEventType::zone
+		};
+		Append(event);
+	}
+
+	int64_t Trace::Now()
+	{
+		return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count();
+	}
+
+	TraceBuffer* Trace::GetBuffer(bool isRecording)
+	{
+		//the only lock on the recording path, taken once per thread
+		if (threadBuffer == nullptr)
+		{
+			lock_guard<mutex> lock(registryMutex);
+
+			buffers.push_back(make_unique<TraceBuffer>());
+			threadBuffer = buffers.back().get();
+			threadBuffer->threadID = static_cast<uint32_t>(buffers.size());
+		}
+
+		if (!isRecording) return threadBuffer;
+
+		//the count is reset before the generation is published,
+		//so the writer never pairs the new generation with old events
+		uint32_t currentGeneration = generation.load(memory_order_acquire);
+		if (threadBuffer->generation.load(memory_order_relaxed) != currentGeneration)
+		{
+			if (threadBuffer->events.empty()) threadBuffer->events.resize(TRACE_EVENTS_PER_THREAD);
+
+			threadBuffer->count.store(0, memory_order_relaxed);
+			threadBuffer->dropped.store(0, memory_order_relaxed);
+			threadBuffer->generation.store(currentGeneration, memory_order_release);
+		}
+
+		return threadBuffer;
+	}
+
+	void Trace::Append(const TraceEvent& event)
+	{
+		TraceBuffer* buffer = GetBuffer(true);
+
+		size_t index = buffer->count.load(memory_order_relaxed);
+		if (index == buffer->events.size())
+		{
+			buffer->dropped.fetch_add(1, memory_order_relaxed);
+			return;
+		}
+
+		buffer->events[index] = event;
+		buffer->count.store(index + 1, memory_order_release);
+	}
+}
+
+string ToJsonString(const char* text)
+{
+	string result = "\"";
+	for (const char* c = text; *c != '\0'; c++)
+	{
+		switch (*c)
+		{
+		case '"': result += "\\\""; break;
+		case '\\': result += "\\\\"; break;
+		case '\n': result += "\\n"; break;
+		case '\t': result += "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(*c) < 0x20) result += ' ';
+			else result += *c;
+			break;
+		}
+	}
+	result += "\"";
+
+	return result;
+}
+
+string ToMicroseconds(int64_t ns)
+{
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.3f", static_cast<double>(ns) / 1000.0);
+
+	return string(buffer);
+}
+
+#endif
\ No newline at end of file
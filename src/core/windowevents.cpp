@@ -0,0 +1,70 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#ifdef _WIN32
+#include <windows.h>
+#elif __linux__
+#include <poll.h>
+#include <X11/Xlib.h>
+#endif
+
+#include <chrono>
+#include <climits>
+
+#include "core/windowevents.hpp"
+
+using CircuitGame::Core::WindowEvents;
+
+using std::chrono::ceil;
+using std::chrono::milliseconds;
+
+namespace CircuitGame::Core
+{
+	bool WindowEvents::WaitFor(
+		Window* window,
+		nanoseconds timeout)
+	{
+		if (window == nullptr) return false;
+
+		//rounded up, a sub-millisecond timeout would otherwise return at once and spin
+		long long timeoutMs = timeout.count() > 0 ? ceil<milliseconds>(timeout).count() : 0;
+		if (timeoutMs > INT_MAX) timeoutMs = INT_MAX;
+
+#ifdef _WIN32
+		//input available also wakes on messages that were seen but not yet removed from the queue
+		DWORD result = MsgWaitForMultipleObjectsEx(
+			0,
+			nullptr,
+			static_cast<DWORD>(timeoutMs),
+			QS_ALLINPUT,
+			MWMO_INPUTAVAILABLE);
+
+		return result == WAIT_OBJECT_0;
+#elif __linux__
+		Display* display = reinterpret_cast<Display*>(window->GetWindowData().display);
+		if (display == nullptr) return false;
+
+		//requests still buffered on our side would leave the server with nothing to answer,
+		//and events Xlib already read off the socket would never show up on it again
+		XFlush(display);
+		if (XPending(display) > 0) return true;
+
+		pollfd connection =
+		{
+			.fd = ConnectionNumber(display),
+			.events = POLLIN,
+			.revents = 0
+		};
+
+		int result = poll(&connection, 1, static_cast<int>(timeoutMs));
+
+		//interrupted by a signal or timed out, the caller runs its loop once either way
+		return result > 0
+			&& (connection.revents & POLLIN) != 0;
+#else
+		return false;
+#endif
+	}
+}
\ No newline at end of file
@@ -14,20 +14,24 @@
 //kalawindow
 #include "graphics/window.hpp"
 #include "core/log.hpp"
-#include "graphics/opengl/shader_opengl.hpp"
 #include "graphics/opengl/opengl_core.hpp"
 
 #include "gameobjects/cube.hpp"
 #include "graphics/texture.hpp"
 #include "graphics/render.hpp"
+#include "graphics/instancebatch.hpp"
+#include "graphics/mesh.hpp"
+#include "graphics/camera.hpp"
 
 using KalaWindow::Graphics::Window;
 using KalaWindow::Core::Logger;
 using KalaWindow::Core::LogType;
-using KalaWindow::Graphics::OpenGL::Shader_OpenGL;
 
 using CircuitGame::Graphics::Texture;
 using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::InstanceBatch;
+using CircuitGame::Graphics::MeshRegistry;
+using CircuitGame::Graphics::Camera;
 
 using std::filesystem::path;
 using std::filesystem::current_path;
@@ -39,19 +43,16 @@ using std::unique_ptr;
 using std::make_unique;
 using std::vector;
 using glm::translate;
+using glm::rotate;
+using glm::radians;
 
-static unsigned int VAO{};
-static unsigned int VBO{};
-static unsigned int EBO{};
 static Window* mainWindow{};
 
-static void CreateCube();
-
 namespace CircuitGame::GameObjects
 {
 	Cube* Cube::Initialize(
 		const string& name,
-		Shader_OpenGL* shader,
+		ShaderProgram* shader,
 		const vec3& pos,
 		const vec3& rot,
 		const vec3& scale)
@@ -61,9 +62,8 @@ namespace CircuitGame::GameObjects
 			"GAMEOBJECT",
 			LogType::LOG_INFO);
 
-		CreateCube();
-
 		unique_ptr<Cube> newCube = make_unique<Cube>();
+		newCube->mesh = MeshRegistry::GetCube();
 		newCube->SetName(name);
 		newCube->SetPos(pos);
 		newCube->SetRot(rot);
@@ -99,7 +99,7 @@ namespace CircuitGame::GameObjects
 			return false;
 		}
 		
-		const Shader_OpenGL* shader = GetShader();
+		const ShaderProgram* shader = GetShader();
 		if (shader == nullptr)
 		{
 			Logger::Print(
@@ -111,145 +111,38 @@ namespace CircuitGame::GameObjects
 			return false;
 		}
 
+		//half the diagonal of the scaled unit cube bounds it in every rotation
 		vec3 pos = GetPos();
-		string posString = 
-			to_string(pos.x) + ", " +
-			to_string(pos.y) + ", " +
-			to_string(pos.z);
-		Logger::Print("Position: " + posString);
-
-		if (!shader->Bind()) return false;
-		
-		unsigned int id = tex->GetTextureID();
+		vec3 halfExtent = vec3(glm::length(GetScale()) * 0.5f);
+		if (!Camera::GetFrustum().Intersects(pos - halfExtent, pos + halfExtent)) return true;
 
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, id);
+		//drawn later together with every other cube sharing this shader and texture
+		InstanceBatch* batch = Render::GetFrameBatch(
+			shader,
+			tex,
+			mesh);
 
-		mat4 model = mat4(1.0f);
-		model = translate(model, vec3(0.0f, 1.0f, 0.0f));
+		vec3 rot = GetRot();
 
-		shader->SetMat4(id, "model", model);
+		mat4 model = translate(mat4(1.0f), pos);
+		model = rotate(model, radians(rot.x), vec3(1.0f, 0.0f, 0.0f));
+		model = rotate(model, radians(rot.y), vec3(0.0f, 1.0f, 0.0f));
+		model = rotate(model, radians(rot.z), vec3(0.0f, 0.0f, 1.0f));
+		model = glm::scale(model, GetScale());
 
-		glBindVertexArray(VAO);
-		glDrawArrays(GL_TRIANGLES, 0, 36);
+		batch->Add(model, vec4(1.0f), tex->GetRegion());
 
 		return true;
 	}
 
 	Cube::~Cube()
 	{
-		if (VAO)
-		{
-			glDeleteVertexArrays(1, &VAO);
-			VAO = 0;
-		}
-		if (VBO)
-		{
-			glDeleteBuffers(1, &VBO);
-			VBO = 0;
-		}
-		if (EBO)
-		{
-			glDeleteBuffers(1, &EBO);
-			EBO = 0;
-		}
+		//the mesh is shared, releasing the handle only deletes it after the last cube is gone
+		mesh.reset();
 
 		Logger::Print(
 			"Destroyed gameobject '" + GetName() + "'!",
 			"GAMEOBJECT",
 			LogType::LOG_SUCCESS);
 	}
-}
-
-void CreateCube()
-{
-	float vertices[] =
-	{
-		//positions          //normals           //texture coords
-		-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
-		 0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  0.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  1.0f,  1.0f,
-		-0.5f,  0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  1.0f,
-		-0.5f, -0.5f, -0.5f,  0.0f,  0.0f, -1.0f,  0.0f,  0.0f,
-
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
-		 0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  0.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  1.0f,  1.0f,
-		-0.5f,  0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  1.0f,
-		-0.5f, -0.5f,  0.5f,  0.0f,  0.0f,  1.0f,  0.0f,  0.0f,
-
-		-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
-		-0.5f,  0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
-		-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
-		-0.5f, -0.5f, -0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
-		-0.5f, -0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
-		-0.5f,  0.5f,  0.5f, -1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
-
-		 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
-		 0.5f,  0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  1.0f,
-		 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
-		 0.5f, -0.5f, -0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  1.0f,
-		 0.5f, -0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  0.0f,  0.0f,
-		 0.5f,  0.5f,  0.5f,  1.0f,  0.0f,  0.0f,  1.0f,  0.0f,
-
-		-0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
-		 0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  1.0f,
-		 0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
-		 0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  1.0f,  0.0f,
-		-0.5f, -0.5f,  0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  0.0f,
-		-0.5f, -0.5f, -0.5f,  0.0f, -1.0f,  0.0f,  0.0f,  1.0f,
-
-		-0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f,
-		 0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  1.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
-		 0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  1.0f,  0.0f,
-		-0.5f,  0.5f,  0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  0.0f,
-		-0.5f,  0.5f, -0.5f,  0.0f,  1.0f,  0.0f,  0.0f,  1.0f
-	};
-
-	glGenVertexArrays(1, &VAO);
-	glGenBuffers(1, &VBO);
-
-	glBindVertexArray(VAO);
-
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(
-		GL_ARRAY_BUFFER,
-		sizeof(vertices),
-		vertices,
-		GL_STATIC_DRAW);
-
-	//position
-	glVertexAttribPointer(
-		0,
-		3,
-		GL_FLOAT,
-		GL_FALSE,
-		8 * sizeof(float),
-		(void*)0);
-	glEnableVertexAttribArray(0);
-
-	//normal
-	glVertexAttribPointer(
-		1,
-		3,
-		GL_FLOAT,
-		GL_FALSE,
-		8 * sizeof(float),
-		(void*)(3 * sizeof(float)));
-	glEnableVertexAttribArray(1);
-
-	//texture
-	glVertexAttribPointer(
-		2,
-		2,
-		GL_FLOAT,
-		GL_FALSE,
-		8 * sizeof(float),
-		(void*)(6 * sizeof(float)));
-
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
-	glBindVertexArray(0);
 }
\ No newline at end of file
@@ -3,7 +3,72 @@
 //This is free software, and you are welcome to redistribute it under certain conditions.
 //Read LICENSE.md for more information.
 
+#include <memory>
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "gameobjects/dirlight.hpp"
+#include "graphics/render.hpp"
+#include "graphics/sceneuniforms.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::SceneUniforms;
+
+using std::unique_ptr;
+using std::make_unique;
+using std::string;
+
 namespace CircuitGame::GameObjects
 {
+	DirLight* DirLight::Initialize(
+		const string& name,
+		const DirLightData& light)
+	{
+		Logger::Print(
+			"Creating directional light '" + name + "'.",
+			"GAMEOBJECT",
+			LogType::LOG_INFO);
+
+		unique_ptr<DirLight> newLight = make_unique<DirLight>();
+		newLight->SetName(name);
+		newLight->SetGameObjectType(GameObjectType::dirLight);
+		newLight->SetLight(light);
+		newLight->SetUpdate(true);
+
+		Render::createdDirLights[name] = move(newLight);
+		Render::runtimeDirLights.push_back(Render::createdDirLights[name].get());
+
+		Logger::Print(
+			"Initialized gameobject '" + name + "'!",
+			"GAMEOBJECT",
+			LogType::LOG_SUCCESS);
+		return Render::createdDirLights[name].get();
+	}
+
+	bool DirLight::Render()
+	{
+		if (!CanUpdate()) return false;
+
+		if (isDirty)
+		{
+			SceneUniforms::SetDirLight(light);
+			isDirty = false;
+		}
+
+		return true;
+	}
 
+	DirLight::~DirLight()
+	{
+		Logger::Print(
+			"Destroyed gameobject '" + GetName() + "'!",
+			"GAMEOBJECT",
+			LogType::LOG_SUCCESS);
+	}
 }
\ No newline at end of file
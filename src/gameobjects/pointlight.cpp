@@ -3,7 +3,92 @@
 //This is free software, and you are welcome to redistribute it under certain conditions.
 //Read LICENSE.md for more information.
 
+#include <memory>
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "gameobjects/pointlight.hpp"
+#include "graphics/render.hpp"
+#include "graphics/lightclusters.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::LightClusters;
+
+using std::unique_ptr;
+using std::make_unique;
+using std::string;
+
+//Share of the color a point light adds regardless of the surface direction
+static constexpr float AMBIENT_SHARE = 0.05f;
+
 namespace CircuitGame::GameObjects
 {
+	PointLight* PointLight::Initialize(
+		const string& name,
+		const vec3& pos,
+		const vec3& color,
+		float intensity,
+		float radius)
+	{
+		Logger::Print(
+			"Creating point light '" + name + "'.",
+			"GAMEOBJECT",
+			LogType::LOG_INFO);
+
+		unique_ptr<PointLight> newLight = make_unique<PointLight>();
+		newLight->SetName(name);
+		newLight->SetGameObjectType(GameObjectType::pointLight);
+		newLight->SetPos(pos);
+
+		//falls off with the distance measured in radii, the shader fades it out at the radius
+		newLight->light.constant = 1.0f;
+		newLight->light.linear = 0.7f;
+		newLight->light.quadratic = 1.8f;
+		newLight->light.intensity = intensity;
+		newLight->light.radius = radius;
+		newLight->SetColor(color);
+		newLight->SetUpdate(true);
+
+		Render::createdPointLights[name] = move(newLight);
+		Render::runtimePointLights.push_back(Render::createdPointLights[name].get());
+
+		Logger::Print(
+			"Initialized gameobject '" + name + "'!",
+			"GAMEOBJECT",
+			LogType::LOG_SUCCESS);
+		return Render::createdPointLights[name].get();
+	}
+
+	void PointLight::SetColor(const vec3& color)
+	{
+		light.ambient = color * AMBIENT_SHARE;
+		light.diffuse = color;
+		light.specular = color;
+		RedrawTracker::Request(RedrawReason::scene);
+	}
+
+	bool PointLight::Render()
+	{
+		if (!CanUpdate()) return false;
+
+		//the clusters drop lights outside the view, so nothing is culled here
+		light.position = GetPos();
+		LightClusters::Submit(light);
+
+		return true;
+	}
 
+	PointLight::~PointLight()
+	{
+		Logger::Print(
+			"Destroyed gameobject '" + GetName() + "'!",
+			"GAMEOBJECT",
+			LogType::LOG_SUCCESS);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,94 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "graphics/atlaspacker.hpp"
+
+using CircuitGame::Graphics::AtlasPacker;
+using CircuitGame::Graphics::AtlasRect;
+
+using std::iota;
+using std::stable_sort;
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	AtlasPacker::AtlasPacker(
+		uint32_t layerSize,
+		uint32_t padding) :
+		layerSize(layerSize),
+		padding(padding) {}
+
+	uint32_t AtlasPacker::Add(
+		uint32_t width,
+		uint32_t height)
+	{
+		rects.push_back({ 0, 0, width, height, 0 });
+		return static_cast<uint32_t>(rects.size() - 1);
+	}
+
+	bool AtlasPacker::Pack()
+	{
+		layerCount = 0;
+		if (rects.empty()) return true;
+
+		//tallest first keeps the wasted space above short rectangles small
+		vector<uint32_t> order(rects.size());
+		iota(order.begin(), order.end(), 0);
+		stable_sort(
+			order.begin(),
+			order.end(),
+			[this](uint32_t a, uint32_t b) { return rects[a].height > rects[b].height; });
+
+		uint32_t layer = 0;
+		uint32_t shelfX = 0;
+		uint32_t shelfY = 0;
+		uint32_t shelfHeight = 0;
+
+		for (uint32_t index : order)
+		{
+			AtlasRect& rect = rects[index];
+
+			uint32_t paddedWidth = rect.width + padding * 2;
+			uint32_t paddedHeight = rect.height + padding * 2;
+
+			if (paddedWidth > layerSize
+				|| paddedHeight > layerSize)
+			{
+				return false;
+			}
+
+			//next shelf
+			if (shelfX + paddedWidth > layerSize)
+			{
+				shelfX = 0;
+				shelfY += shelfHeight;
+				shelfHeight = 0;
+			}
+
+			//next layer
+			if (shelfY + paddedHeight > layerSize)
+			{
+				layer++;
+				shelfX = 0;
+				shelfY = 0;
+				shelfHeight = 0;
+			}
+
+			rect.x = shelfX + padding;
+			rect.y = shelfY + padding;
+			rect.layer = layer;
+
+			shelfX += paddedWidth;
+			if (paddedHeight > shelfHeight) shelfHeight = paddedHeight;
+		}
+
+		layerCount = layer + 1;
+		return true;
+	}
+}
\ No newline at end of file
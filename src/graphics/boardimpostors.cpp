@@ -0,0 +1,539 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//glm
+#include "glm/gtc/matrix_transform.hpp"
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/boardimpostors.hpp"
+#include "graphics/boardview.hpp"
+#include "graphics/wirerenderer.hpp"
+#include "graphics/netstatebuffer.hpp"
+#include "graphics/lightclusters.hpp"
+#include "graphics/sceneuniforms.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+#include "graphics/uniformcache.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::BoardImpostors;
+using CircuitGame::Graphics::ImpostorState;
+using CircuitGame::Graphics::ImpostorQuad;
+using CircuitGame::Graphics::BoardView;
+using CircuitGame::Graphics::InstanceBatch;
+using CircuitGame::Graphics::InstanceRange;
+using CircuitGame::Graphics::Texture;
+using CircuitGame::Graphics::WireRenderer;
+using CircuitGame::Graphics::NetStateBuffer;
+using CircuitGame::Graphics::LightClusters;
+using CircuitGame::Graphics::SceneUniforms;
+using CircuitGame::Graphics::CameraData;
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::UniformCache;
+using CircuitGame::Graphics::IMPOSTOR_CHUNK_SIDE;
+using CircuitGame::Graphics::IMPOSTOR_SIZE;
+
+using glm::lookAt;
+using glm::ortho;
+using std::to_string;
+using std::vector;
+
+//Mip levels of an impostor, down to a single texel
+static constexpr GLint IMPOSTOR_LEVEL_COUNT = 8;
+
+//Stale impostors rendered per frame, a running simulation refreshes the overview over a few frames
+static constexpr uint32_t STALE_RENDER_BUDGET = 16;
+
+//Wires in an impostor are one texel wide, half a gate
+static constexpr float IMPOSTOR_LINE_WIDTH = 1.0f;
+
+//The orthographic camera of an impostor looks down from here, well above every gate
+static constexpr float IMPOSTOR_EYE_HEIGHT = 10.0f;
+
+//Board plane rectangle covered by a chunk, min in xy and max in zw
+static vec4 GetChunkRect(
+	uint32_t column,
+	uint32_t row,
+	float spacing);
+
+namespace CircuitGame::Graphics
+{
+	bool BoardImpostors::Initialize(const ShaderProgram* newShader)
+	{
+		if (newShader == nullptr)
+		{
+			Logger::Print(
+				"Cannot initialize board impostors because their shader is nullptr!",
+				"BOARD_IMPOSTORS",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		shader = newShader;
+
+		glGetIntegerv(GL_MAX_ARRAY_TEXTURE_LAYERS, &maxLayers);
+
+		//storage follows the chunk count, it is allocated by Reset
+		glGenTextures(1, &texture);
+		GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, texture);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, IMPOSTOR_LEVEL_COUNT - 1);
+
+		//one depth buffer serves every layer, impostors are rendered one after another
+		glGenRenderbuffers(1, &depthBuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, depthBuffer);
+		glRenderbufferStorage(
+			GL_RENDERBUFFER,
+			GL_DEPTH24_STENCIL8,
+			IMPOSTOR_SIZE,
+			IMPOSTOR_SIZE);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glGenFramebuffers(1, &framebuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferRenderbuffer(
+			GL_FRAMEBUFFER,
+			GL_DEPTH_STENCIL_ATTACHMENT,
+			GL_RENDERBUFFER,
+			depthBuffer);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		//color only, mips are blitted from one level of a layer to the next
+		glGenFramebuffers(1, &mipReadFramebuffer);
+		glGenFramebuffers(1, &mipDrawFramebuffer);
+
+		//0 to 1 across the quad, also its texture coordinates
+		const vec2 corners[6] =
+		{
+			vec2(0.0f, 0.0f), vec2(1.0f, 0.0f), vec2(1.0f, 1.0f),
+			vec2(0.0f, 0.0f), vec2(1.0f, 1.0f), vec2(0.0f, 1.0f)
+		};
+
+		glGenVertexArrays(1, &quadVAO);
+		glGenBuffers(1, &cornerVBO);
+		glGenBuffers(1, &instanceVBO);
+
+		GLState::BindVertexArray(quadVAO);
+
+		glBindBuffer(GL_ARRAY_BUFFER, cornerVBO);
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			sizeof(corners),
+			corners,
+			GL_STATIC_DRAW);
+		glVertexAttribPointer(
+			0,
+			2,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(vec2),
+			(void*)0);
+		glEnableVertexAttribArray(0);
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glVertexAttribPointer(
+			1,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(ImpostorQuad),
+			(void*)offsetof(ImpostorQuad, rect));
+		glEnableVertexAttribArray(1);
+		glVertexAttribDivisor(1, 1);
+
+		glVertexAttribPointer(
+			2,
+			1,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(ImpostorQuad),
+			(void*)offsetof(ImpostorQuad, layer));
+		glEnableVertexAttribArray(2);
+		glVertexAttribDivisor(2, 1);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		if (!GLState::UseShader(shader)) return false;
+
+		UniformCache::SetInt(shader->GetProgramID(), "impostors", 0);
+
+		return true;
+	}
+
+	void BoardImpostors::Reset(
+		uint32_t side,
+		uint32_t rows,
+		float newSpacing)
+	{
+		states.clear();
+		chunkCuller.Clear();
+		visibleChunks.clear();
+		visibleQuads.clear();
+
+		chunkColumns = (side + IMPOSTOR_CHUNK_SIDE - 1) / IMPOSTOR_CHUNK_SIDE;
+		chunkRows = (rows + IMPOSTOR_CHUNK_SIDE - 1) / IMPOSTOR_CHUNK_SIDE;
+		spacing = newSpacing;
+
+		uint32_t chunkCount = chunkColumns * chunkRows;
+		if (chunkCount == 0
+			|| texture == 0)
+		{
+			return;
+		}
+
+		if (chunkCount > static_cast<uint32_t>(maxLayers))
+		{
+			Logger::Print(
+				"Board needs '" + to_string(chunkCount) + "' impostors but an array texture holds at most '"
+				+ to_string(maxLayers) + "' layers, the zoomed-out overview is disabled!",
+				"BOARD_IMPOSTORS",
+				LogType::LOG_WARNING);
+
+			return;
+		}
+
+		GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, texture);
+		for (GLint level = 0; level < IMPOSTOR_LEVEL_COUNT; level++)
+		{
+			GLsizei size = IMPOSTOR_SIZE >> level;
+			glTexImage3D(
+				GL_TEXTURE_2D_ARRAY,
+				level,
+				GL_RGBA8,
+				size,
+				size,
+				static_cast<GLsizei>(chunkCount),
+				0,
+				GL_RGBA,
+				GL_UNSIGNED_BYTE,
+				nullptr);
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glFramebufferTextureLayer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, texture, 0, 0);
+		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		if (status != GL_FRAMEBUFFER_COMPLETE)
+		{
+			Logger::Print(
+				"Impostor framebuffer is incomplete with status '" + to_string(status) + "', the zoomed-out overview is disabled!",
+				"BOARD_IMPOSTORS",
+				LogType::LOG_ERROR,
+				2);
+
+			return;
+		}
+
+		states.assign(chunkCount, ImpostorState::missing);
+
+		//flat boxes at the gate tops, row major like the layers
+		for (uint32_t row = 0; row < chunkRows; row++)
+		{
+			for (uint32_t column = 0; column < chunkColumns; column++)
+			{
+				vec4 rect = GetChunkRect(column, row, spacing);
+				chunkCuller.Add(
+					vec3(rect.x, rect.y, -0.5f),
+					vec3(rect.z, rect.w, 0.5f));
+			}
+		}
+	}
+
+	void BoardImpostors::MarkStale()
+	{
+		for (ImpostorState& state : states)
+		{
+			if (state == ImpostorState::current) state = ImpostorState::stale;
+		}
+	}
+
+	bool BoardImpostors::IsActive()
+	{
+		if (states.empty()) return false;
+
+		float pixelsPerGate = Camera::GetPixelsPerUnit() * spacing;
+		float texelsPerGate = static_cast<float>(IMPOSTOR_SIZE) / static_cast<float>(IMPOSTOR_CHUNK_SIDE);
+
+		//past this point the impostor has as much detail as the screen can show
+		return pixelsPerGate < texelsPerGate;
+	}
+
+	bool BoardImpostors::Update()
+	{
+		if (!IsActive()) return false;
+
+		visibleChunks.clear();
+		chunkCuller.Cull(Camera::GetFrustum(), visibleChunks);
+
+		//missing impostors would leave holes in the board, so they ignore the budget
+		vector<uint32_t> pending{};
+		uint32_t staleCount = 0;
+		bool hasStale = false;
+		for (uint32_t chunk : visibleChunks)
+		{
+			if (states[chunk] == ImpostorState::missing) pending.push_back(chunk);
+			else if (states[chunk] == ImpostorState::stale)
+			{
+				if (staleCount < STALE_RENDER_BUDGET)
+				{
+					pending.push_back(chunk);
+					staleCount++;
+				}
+				else hasStale = true;
+			}
+		}
+
+		if (pending.empty()) return hasStale;
+
+		float lineWidth = WireRenderer::GetLineWidth();
+		WireRenderer::SetLineWidth(IMPOSTOR_LINE_WIDTH);
+
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glViewport(0, 0, IMPOSTOR_SIZE, IMPOSTOR_SIZE);
+
+		//transparent around the gates, the shader discards it
+		glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+		GLState::SetCapability(GL_DEPTH_TEST, true);
+		NetStateBuffer::Bind();
+
+		//the light clusters belong to the main camera, impostors are lit by the directional light only
+		LightClusters::SetEnabled(false);
+
+		for (uint32_t chunk : pending)
+		{
+			RenderChunk(chunk);
+		}
+
+		//only the layers rendered above, glGenerateMipmap would redo every layer of the array
+		for (uint32_t chunk : pending)
+		{
+			DownsampleLayer(chunk);
+		}
+
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+		vec2 viewSize = Camera::GetViewSize();
+		glViewport(
+			0,
+			0,
+			static_cast<GLsizei>(viewSize.x),
+			static_cast<GLsizei>(viewSize.y));
+
+		WireRenderer::SetLineWidth(lineWidth);
+		LightClusters::SetEnabled(true);
+
+		return hasStale;
+	}
+
+	void BoardImpostors::Cull(const Frustum& frustum)
+	{
+		visibleChunks.clear();
+		visibleQuads.clear();
+
+		chunkCuller.Cull(frustum, visibleChunks);
+
+		for (uint32_t chunk : visibleChunks)
+		{
+			if (states[chunk] == ImpostorState::missing) continue;
+
+			visibleQuads.push_back(
+			{
+				GetChunkRect(chunk % chunkColumns, chunk / chunkColumns, spacing),
+				static_cast<float>(chunk)
+			});
+		}
+	}
+
+	void BoardImpostors::Draw()
+	{
+		if (visibleQuads.empty()
+			|| !GLState::UseShader(shader))
+		{
+			return;
+		}
+
+		GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, texture);
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			visibleQuads.size() * sizeof(ImpostorQuad),
+			visibleQuads.data(),
+			GL_STREAM_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		GLState::BindVertexArray(quadVAO);
+		glDrawArraysInstanced(
+			GL_TRIANGLES,
+			0,
+			6,
+			static_cast<GLsizei>(visibleQuads.size()));
+	}
+
+	void BoardImpostors::Shutdown()
+	{
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteFramebuffers(1, &mipReadFramebuffer);
+		glDeleteFramebuffers(1, &mipDrawFramebuffer);
+		glDeleteRenderbuffers(1, &depthBuffer);
+		glDeleteTextures(1, &texture);
+		GLState::OnTextureDeleted(texture);
+		glDeleteVertexArrays(1, &quadVAO);
+		GLState::OnVertexArrayDeleted(quadVAO);
+		glDeleteBuffers(1, &cornerVBO);
+		glDeleteBuffers(1, &instanceVBO);
+
+		framebuffer = 0;
+		mipReadFramebuffer = 0;
+		mipDrawFramebuffer = 0;
+		depthBuffer = 0;
+		texture = 0;
+		quadVAO = 0;
+		cornerVBO = 0;
+		instanceVBO = 0;
+		shader = nullptr;
+
+		chunkColumns = 0;
+		chunkRows = 0;
+		states.clear();
+		chunkCuller.Clear();
+		visibleChunks.clear();
+		visibleQuads.clear();
+	}
+
+	void BoardImpostors::DownsampleLayer(uint32_t layer)
+	{
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, mipReadFramebuffer);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, mipDrawFramebuffer);
+
+		for (GLint level = 1; level < IMPOSTOR_LEVEL_COUNT; level++)
+		{
+			glFramebufferTextureLayer(
+				GL_READ_FRAMEBUFFER,
+				GL_COLOR_ATTACHMENT0,
+				texture,
+				level - 1,
+				static_cast<GLint>(layer));
+			glFramebufferTextureLayer(
+				GL_DRAW_FRAMEBUFFER,
+				GL_COLOR_ATTACHMENT0,
+				texture,
+				level,
+				static_cast<GLint>(layer));
+
+			//halving with linear filtering samples between four texels, the same box filter glGenerateMipmap uses
+			GLint sourceSize = IMPOSTOR_SIZE >> (level - 1);
+			GLint size = IMPOSTOR_SIZE >> level;
+			glBlitFramebuffer(
+				0,
+				0,
+				sourceSize,
+				sourceSize,
+				0,
+				0,
+				size,
+				size,
+				GL_COLOR_BUFFER_BIT,
+				GL_LINEAR);
+		}
+
+		//the impostor framebuffer is bound to both targets again for the next chunk
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	}
+
+	void BoardImpostors::RenderChunk(uint32_t chunk)
+	{
+		vec4 rect = GetChunkRect(chunk % chunkColumns, chunk / chunkColumns, spacing);
+		vec2 center = vec2(rect.x + rect.z, rect.y + rect.w) * 0.5f;
+		vec2 extent = vec2(rect.z - rect.x, rect.w - rect.y) * 0.5f;
+		vec3 eye = vec3(center, IMPOSTOR_EYE_HEIGHT);
+
+		//the same camera layout as the main one, so texel rows run up the board like screen rows
+		CameraData camera =
+		{
+			.view = lookAt(eye, vec3(center, 0.0f), vec3(0.0f, 1.0f, 0.0f)),
+			.projection = ortho(-extent.x, extent.x, -extent.y, extent.y, 0.1f, IMPOSTOR_EYE_HEIGHT * 2.0f),
+			.position = vec4(eye, 1.0f),
+			.viewSize = vec4(
+				static_cast<float>(IMPOSTOR_SIZE),
+				static_cast<float>(IMPOSTOR_SIZE),
+				1.0f / static_cast<float>(IMPOSTOR_SIZE),
+				1.0f / static_cast<float>(IMPOSTOR_SIZE))
+		};
+
+		Frustum frustum{};
+		frustum.Update(camera.projection * camera.view);
+
+		SceneUniforms::Upload(camera);
+
+		glFramebufferTextureLayer(
+			GL_FRAMEBUFFER,
+			GL_COLOR_ATTACHMENT0,
+			texture,
+			0,
+			static_cast<GLint>(chunk));
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		//the board and wire renderers cull against the impostor camera, so only this chunk is drawn
+		InstanceBatch* batch = BoardView::GetBatch();
+		if (batch != nullptr
+			&& batch->GetInstanceCount() > 0
+			&& GLState::UseShader(batch->GetShader()))
+		{
+			const Texture* batchTexture = batch->GetTexture();
+			GLState::BindTexture(
+				0,
+				batchTexture != nullptr ? batchTexture->GetTarget() : GL_TEXTURE_2D_ARRAY,
+				batchTexture != nullptr ? batchTexture->GetTextureID() : 0);
+			GLState::BindVertexArray(batch->GetMesh()->GetVAO());
+
+			BoardView::Cull(frustum);
+			for (const InstanceRange& range : BoardView::GetVisibleRanges())
+			{
+				batch->Draw(range.first, range.count);
+			}
+		}
+
+		WireRenderer::Cull(frustum);
+		WireRenderer::Draw();
+
+		states[chunk] = ImpostorState::current;
+	}
+}
+
+vec4 GetChunkRect(
+	uint32_t column,
+	uint32_t row,
+	float spacing)
+{
+	//gate centers sit on multiples of spacing, row 0 at y = 0 and the rows below it
+	float firstColumn = static_cast<float>(column * IMPOSTOR_CHUNK_SIDE);
+	float firstRow = static_cast<float>(row * IMPOSTOR_CHUNK_SIDE);
+	float side = static_cast<float>(IMPOSTOR_CHUNK_SIDE);
+
+	return vec4(
+		(firstColumn - 0.5f) * spacing,
+		-(firstRow + side - 0.5f) * spacing,
+		(firstColumn + side - 0.5f) * spacing,
+		-(firstRow - 0.5f) * spacing);
+}
\ No newline at end of file
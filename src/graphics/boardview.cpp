@@ -0,0 +1,324 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+//glm
+#include "glm/gtc/matrix_transform.hpp"
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "graphics/boardview.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/redrawtracker.hpp"
+#include "graphics/wirerenderer.hpp"
+#include "graphics/boardimpostors.hpp"
+#include "simulation/simulator.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::BoardView;
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::RedrawTracker;
+using CircuitGame::Graphics::RedrawReason;
+using CircuitGame::Graphics::WireRenderer;
+using CircuitGame::Graphics::BoardImpostors;
+using CircuitGame::Simulation::Simulator;
+using CircuitGame::Simulation::GateType;
+using CircuitGame::Simulation::Gate;
+using CircuitGame::Simulation::NO_NET;
+
+using glm::translate;
+using std::min;
+using std::ceil;
+using std::sqrt;
+using std::make_unique;
+using std::to_string;
+using std::vector;
+using glm::ivec2;
+
+//Distance between the centers of two neighbouring gates, the mesh is one unit wide
+static constexpr float GATE_SPACING = 1.25f;
+
+//Gates along one side of a culling chunk
+static constexpr uint32_t CHUNK_SIDE = 32;
+
+//Wires run just above the gate tops, the mesh is one unit high
+static constexpr float WIRE_HEIGHT = 0.51f;
+
+//Nets driven from outside the netlist, like clocks, have no driving gate to route from
+static constexpr uint32_t NO_DRIVER = UINT32_MAX;
+
+static_assert(NO_NET == CircuitGame::Graphics::INSTANCE_NO_NET);
+
+static vec4 GetGateColor(GateType type);
+
+namespace CircuitGame::Graphics
+{
+	bool BoardView::Initialize(
+		const ShaderProgram* shader,
+		const ShaderProgram* wireShader,
+		const ShaderProgram* impostorShader,
+		const Texture* texture,
+		const MeshHandle& mesh)
+	{
+		if (shader == nullptr)
+		{
+			Logger::Print(
+				"Cannot initialize board view because its shader is nullptr!",
+				"BOARD_VIEW",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		if (!WireRenderer::Initialize(
+			wireShader,
+			GATE_SPACING,
+			WIRE_HEIGHT)
+			|| !BoardImpostors::Initialize(impostorShader))
+		{
+			return false;
+		}
+
+		batch = make_unique<InstanceBatch>(
+			shader,
+			texture,
+			mesh);
+
+		return true;
+	}
+
+	void BoardView::Refresh()
+	{
+		if (batch == nullptr) return;
+
+		const auto& board = Simulator::board;
+
+		const Texture* texture = batch->GetTexture();
+		unsigned int textureID = texture != nullptr ? texture->GetTextureID() : 0;
+
+		uint32_t gateCount = board.GetGateCount();
+		if (gateCount == lastGateCount
+			&& textureID == lastTextureID)
+		{
+			return;
+		}
+		bool isNewLayout = gateCount != lastGateCount;
+		uint32_t previousGateCount = lastGateCount;
+		lastGateCount = gateCount;
+		lastTextureID = textureID;
+
+		RedrawTracker::Request(RedrawReason::scene);
+
+		uint32_t side = static_cast<uint32_t>(ceil(sqrt(static_cast<double>(gateCount))));
+
+		if (isNewLayout)
+		{
+			//gates appended without widening the grid keep their cells,
+			//so only the wires reaching the new gates are added and only their chunks rebuild
+			if (side == lastSide
+				&& previousGateCount < gateCount)
+			{
+				AddWires(previousGateCount, side);
+			}
+			else
+			{
+				WireRenderer::Clear();
+				if (gateCount > 0) AddWires(0, side);
+			}
+			lastSide = side;
+		}
+
+		batch->Clear();
+		chunkRanges.clear();
+		chunkCuller.Clear();
+		visibleRanges.clear();
+
+		uint32_t rows = side > 0 ? (gateCount + side - 1) / side : 0;
+
+		//every impostor shows the old instances, so all of them are rendered again
+		BoardImpostors::Reset(side, rows, GATE_SPACING);
+
+		if (gateCount == 0) return;
+
+		TextureRegion region = texture != nullptr ? texture->GetRegion() : TextureRegion{};
+
+		//gates are placed row major from the top left, so gates added together end up next to each other,
+		//but stored chunk by chunk so every chunk is one range of the batch
+		for (uint32_t chunkRow = 0; chunkRow < rows; chunkRow += CHUNK_SIDE)
+		{
+			for (uint32_t chunkColumn = 0; chunkColumn < side; chunkColumn += CHUNK_SIDE)
+			{
+				size_t first = batch->GetInstanceCount();
+
+				uint32_t rowEnd = min(chunkRow + CHUNK_SIDE, rows);
+				uint32_t columnEnd = min(chunkColumn + CHUNK_SIDE, side);
+
+				for (uint32_t row = chunkRow; row < rowEnd; row++)
+				{
+					for (uint32_t column = chunkColumn; column < columnEnd; column++)
+					{
+						uint32_t i = row * side + column;
+						if (i >= gateCount) break;
+
+						float x = static_cast<float>(column) * GATE_SPACING;
+						float y = -static_cast<float>(row) * GATE_SPACING;
+
+						//gates light up with the net they drive, memory writes drive NO_NET and keep their color
+						const Gate& gate = board.GetGate(i);
+						batch->Add(
+							translate(mat4(1.0f), vec3(x, y, 0.0f)),
+							GetGateColor(gate.type),
+							region,
+							gate.output);
+					}
+				}
+
+				size_t count = batch->GetInstanceCount() - first;
+				if (count == 0) continue;
+
+				//the mesh is a unit cube around each gate center
+				chunkCuller.Add(
+					vec3(
+						static_cast<float>(chunkColumn) * GATE_SPACING - 0.5f,
+						-static_cast<float>(rowEnd - 1) * GATE_SPACING - 0.5f,
+						-0.5f),
+					vec3(
+						static_cast<float>(columnEnd - 1) * GATE_SPACING + 0.5f,
+						-static_cast<float>(chunkRow) * GATE_SPACING + 0.5f,
+						0.5f));
+				chunkRanges.push_back({ first, count });
+			}
+		}
+
+		//a texture swap keeps the camera where the player left it
+		if (!isNewLayout) return;
+
+		float extent = static_cast<float>(side - 1) * GATE_SPACING;
+		Camera::Frame(
+			vec2(-0.5f, -extent - 0.5f),
+			vec2(extent + 0.5f, 0.5f));
+
+		Logger::Print(
+			"Laid out '" + to_string(gateCount) + "' gates on a '" + to_string(side) + "' wide grid.",
+			"BOARD_VIEW",
+			LogType::LOG_DEBUG);
+	}
+
+	void BoardView::Cull(const Frustum& frustum)
+	{
+		visibleChunks.clear();
+		visibleRanges.clear();
+
+		chunkCuller.Cull(frustum, visibleChunks);
+
+		//chunks next to each other in the batch merge into one range, a fully visible board is one draw
+		for (uint32_t chunk : visibleChunks)
+		{
+			const InstanceRange& range = chunkRanges[chunk];
+
+			if (!visibleRanges.empty()
+				&& visibleRanges.back().first + visibleRanges.back().count == range.first)
+			{
+				visibleRanges.back().count += range.count;
+			}
+			else visibleRanges.push_back(range);
+		}
+	}
+
+	void BoardView::Shutdown()
+	{
+		batch.reset();
+		chunkRanges.clear();
+		chunkCuller.Clear();
+		visibleChunks.clear();
+		visibleRanges.clear();
+		lastGateCount = UINT32_MAX;
+		lastTextureID = 0;
+		lastSide = 0;
+
+		WireRenderer::Shutdown();
+		BoardImpostors::Shutdown();
+	}
+
+	void BoardView::AddWires(
+		uint32_t firstGate,
+		uint32_t side)
+	{
+		const auto& board = Simulator::board;
+		uint32_t gateCount = board.GetGateCount();
+
+		vector<uint32_t> drivers(board.GetNetCount(), NO_DRIVER);
+		for (uint32_t i = 0; i < gateCount; i++)
+		{
+			uint32_t net = board.GetGate(i).output;
+			if (net != NO_NET) drivers[net] = i;
+		}
+
+		auto getCell = [side](uint32_t gate)
+			{
+				return ivec2(
+					static_cast<int>(gate % side),
+					-static_cast<int>(gate / side));
+			};
+
+		vector<ivec2> points(3);
+		for (uint32_t reader = 0; reader < gateCount; reader++)
+		{
+			const Gate& gate = board.GetGate(reader);
+
+			for (uint32_t input = 0; input < gate.inputCount; input++)
+			{
+				uint32_t net = board.GetGateInput(gate, input);
+				uint32_t driver = drivers[net];
+
+				//old gates may read a net only a new gate drives
+				if (driver == NO_DRIVER
+					|| driver == reader
+					|| (driver < firstGate
+					&& reader < firstGate))
+				{
+					continue;
+				}
+
+				//along the row of the driver first, then along the column of the reader
+				ivec2 from = getCell(driver);
+				ivec2 to = getCell(reader);
+				points[0] = from;
+				points[1] = ivec2(to.x, from.y);
+				points[2] = to;
+
+				WireRenderer::AddWire(points, net);
+			}
+		}
+	}
+}
+
+vec4 GetGateColor(GateType type)
+{
+	switch (type)
+	{
+	case GateType::buffer:      return vec4(0.8f, 0.8f, 0.8f, 1.0f);
+	case GateType::notGate:     return vec4(0.9f, 0.5f, 0.5f, 1.0f);
+	case GateType::andGate:     return vec4(0.5f, 0.7f, 1.0f, 1.0f);
+	case GateType::orGate:      return vec4(0.5f, 1.0f, 0.6f, 1.0f);
+	case GateType::xorGate:     return vec4(1.0f, 0.9f, 0.4f, 1.0f);
+	case GateType::nandGate:    return vec4(0.3f, 0.4f, 0.8f, 1.0f);
+	case GateType::norGate:     return vec4(0.3f, 0.7f, 0.4f, 1.0f);
+	case GateType::xnorGate:    return vec4(0.8f, 0.6f, 0.2f, 1.0f);
+	case GateType::memoryRead:  return vec4(0.8f, 0.4f, 0.9f, 1.0f);
+	case GateType::memoryWrite: return vec4(0.6f, 0.2f, 0.7f, 1.0f);
+	}
+
+	return vec4(1.0f);
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <vector>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+	#define CIRCUITGAME_CULL_SSE 1
+	#include <xmmintrin.h>
+#endif
+
+#include "graphics/boxculler.hpp"
+
+using CircuitGame::Graphics::BoxCuller;
+using CircuitGame::Graphics::Frustum;
+
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	uint32_t BoxCuller::Add(
+		const vec3& min,
+		const vec3& max)
+	{
+		//grow all six arrays by a group of four at once
+		if (count % 4 == 0)
+		{
+			size_t size = count + 4;
+			minX.resize(size);
+			minY.resize(size);
+			minZ.resize(size);
+			maxX.resize(size);
+			maxY.resize(size);
+			maxZ.resize(size);
+		}
+
+		minX[count] = min.x;
+		minY[count] = min.y;
+		minZ[count] = min.z;
+		maxX[count] = max.x;
+		maxY[count] = max.y;
+		maxZ[count] = max.z;
+
+		return static_cast<uint32_t>(count++);
+	}
+
+	void BoxCuller::Clear()
+	{
+		minX.clear();
+		minY.clear();
+		minZ.clear();
+		maxX.clear();
+		maxY.clear();
+		maxZ.clear();
+
+		count = 0;
+	}
+
+	void BoxCuller::Cull(
+		const Frustum& frustum,
+		vector<uint32_t>& visible) const
+	{
+		for (size_t group = 0; group < count; group += 4)
+		{
+			//one bit per box, set once a plane has the box fully behind it
+#ifdef CIRCUITGAME_CULL_SSE
+			__m128 outside = _mm_setzero_ps();
+
+			for (size_t p = 0; p < Frustum::PLANE_COUNT; p++)
+			{
+				const vec4& plane = frustum.GetPlane(p);
+
+				//the sign of the normal picks the same corner for all four boxes
+				__m128 x = _mm_loadu_ps(plane.x >= 0.0f ? &maxX[group] : &minX[group]);
+				__m128 y = _mm_loadu_ps(plane.y >= 0.0f ? &maxY[group] : &minY[group]);
+				__m128 z = _mm_loadu_ps(plane.z >= 0.0f ? &maxZ[group] : &minZ[group]);
+
+				__m128 distance = _mm_add_ps(
+					_mm_add_ps(
+						_mm_mul_ps(x, _mm_set1_ps(plane.x)),
+						_mm_mul_ps(y, _mm_set1_ps(plane.y))),
+					_mm_add_ps(
+						_mm_mul_ps(z, _mm_set1_ps(plane.z)),
+						_mm_set1_ps(plane.w)));
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_setzero_ps()));
+			}
+
+			int outsideMask = _mm_movemask_ps(outside);
+#else
+			int outsideMask = 0;
+			for (size_t i = 0; i < 4; i++)
+			{
+				size_t box = group + i;
+				if (!frustum.Intersects(
+					vec3(minX[box], minY[box], minZ[box]),
+					vec3(maxX[box], maxY[box], maxZ[box])))
+				{
+					outsideMask |= 1 << i;
+				}
+			}
+#endif
+			for (size_t i = 0; i < 4; i++)
+			{
+				size_t box = group + i;
+				if (box >= count) break;
+
+				if ((outsideMask & (1 << i)) == 0) visible.push_back(static_cast<uint32_t>(box));
+			}
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,117 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cmath>
+
+//glm
+#include "glm/gtc/matrix_transform.hpp"
+
+#include "graphics/camera.hpp"
+#include "graphics/redrawtracker.hpp"
+
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::RedrawTracker;
+using CircuitGame::Graphics::RedrawReason;
+
+using glm::lookAt;
+using glm::perspective;
+using glm::radians;
+using std::clamp;
+using std::max;
+using std::pow;
+using std::tan;
+
+//Keeps a little of the background visible around a framed rectangle
+static constexpr float FRAME_MARGIN = 1.1f;
+
+//Each zoom step changes the distance to the board by this factor
+static constexpr float ZOOM_STEP = 0.85f;
+
+static constexpr float MIN_DISTANCE = 2.0f;
+static constexpr float MAX_DISTANCE = 100000.0f;
+
+namespace CircuitGame::Graphics
+{
+	void Camera::Frame(
+		const vec2& min,
+		const vec2& max)
+	{
+		vec2 center = (min + max) * 0.5f;
+		vec2 extent = (max - min) * 0.5f * FRAME_MARGIN;
+
+		float aspect = viewSize.y > 0.0f ? viewSize.x / viewSize.y : 1.0f;
+		float halfHeight = std::max(extent.y, extent.x / aspect);
+		halfHeight = std::max(halfHeight, 1.0f);
+
+		float distance = halfHeight / tan(radians(fieldOfView) * 0.5f);
+
+		position = vec3(center, distance);
+		UpdateMatrices();
+	}
+
+	void Camera::SetViewSize(const vec2& newViewSize)
+	{
+		if (newViewSize.x <= 0.0f
+			|| newViewSize.y <= 0.0f)
+		{
+			return;
+		}
+
+		viewSize = newViewSize;
+		UpdateMatrices();
+	}
+
+	void Camera::Pan(const vec2& pixelDelta)
+	{
+		if (pixelDelta.x == 0.0f
+			&& pixelDelta.y == 0.0f)
+		{
+			return;
+		}
+
+		//world units covered by one pixel on the board plane
+		float worldPerPixel = 1.0f / GetPixelsPerUnit();
+
+		position.x -= pixelDelta.x * worldPerPixel;
+		position.y += pixelDelta.y * worldPerPixel;
+		UpdateMatrices();
+	}
+
+	void Camera::Zoom(float steps)
+	{
+		if (steps == 0.0f) return;
+
+		position.z = clamp(
+			position.z * pow(ZOOM_STEP, steps),
+			MIN_DISTANCE,
+			MAX_DISTANCE);
+		UpdateMatrices();
+	}
+
+	float Camera::GetPixelsPerUnit()
+	{
+		return viewSize.y / (2.0f * position.z * tan(radians(fieldOfView) * 0.5f));
+	}
+
+	void Camera::UpdateMatrices()
+	{
+		view = lookAt(
+			position,
+			vec3(position.x, position.y, 0.0f),
+			vec3(0.0f, 1.0f, 0.0f));
+
+		//the far plane only has to reach a little past the board
+		projection = perspective(
+			radians(fieldOfView),
+			viewSize.x / viewSize.y,
+			0.1f,
+			max(position.z * 2.0f, 100.0f));
+
+		frustum.Update(projection * view);
+
+		RedrawTracker::Request(RedrawReason::camera);
+	}
+}
\ No newline at end of file
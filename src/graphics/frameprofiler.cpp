@@ -0,0 +1,369 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "graphics/frameprofiler.hpp"
+#include "graphics/overlay.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::FrameProfiler;
+using CircuitGame::Graphics::ProfiledFrame;
+using CircuitGame::Graphics::CpuScope;
+using CircuitGame::Graphics::GpuPass;
+using CircuitGame::Graphics::Overlay;
+using CircuitGame::Graphics::CPU_SCOPE_COUNT;
+using CircuitGame::Graphics::GPU_PASS_COUNT;
+
+using std::min;
+using std::max;
+using std::snprintf;
+using std::string;
+using std::to_string;
+using std::chrono::steady_clock;
+using std::chrono::time_point;
+using std::chrono::duration;
+using std::chrono::seconds;
+
+static constexpr float MARGIN = 10.0f;
+static constexpr float COLUMN_WIDTH = 2.0f;
+static constexpr float GRAPH_HALF_HEIGHT = 100.0f;
+
+//milliseconds that fill half of the graph, the reference lines mark a 60 Hz frame
+static constexpr float GRAPH_MS = 33.3f;
+static constexpr float REFERENCE_MS = 16.7f;
+
+static const vec4 backgroundColor = vec4(0.05f, 0.05f, 0.05f, 1.0f);
+static const vec4 referenceColor = vec4(0.4f, 0.4f, 0.4f, 1.0f);
+static const vec4 frameColor = vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+static const char* cpuScopeNames[CPU_SCOPE_COUNT] =
+{
+	"window",
+	"input",
+	"simulation",
+	"uploads",
+	"impostors",
+	"instances",
+	"culling",
+	"submit",
+	"swap"
+};
+static const vec4 cpuScopeColors[CPU_SCOPE_COUNT] =
+{
+	vec4(0.55f, 0.55f, 0.60f, 1.0f),
+	vec4(0.85f, 0.85f, 0.30f, 1.0f),
+	vec4(0.25f, 0.80f, 0.35f, 1.0f),
+	vec4(0.30f, 0.75f, 0.80f, 1.0f),
+	vec4(0.65f, 0.40f, 0.85f, 1.0f),
+	vec4(0.95f, 0.55f, 0.20f, 1.0f),
+	vec4(0.95f, 0.35f, 0.55f, 1.0f),
+	vec4(0.30f, 0.45f, 0.95f, 1.0f),
+	vec4(0.35f, 0.35f, 0.35f, 1.0f)
+};
+
+static const char* gpuPassNames[GPU_PASS_COUNT] =
+{
+	"impostors",
+	"scene",
+	"board",
+	"overlay"
+};
+static const vec4 gpuPassColors[GPU_PASS_COUNT] =
+{
+	vec4(0.65f, 0.40f, 0.85f, 1.0f),
+	vec4(0.90f, 0.25f, 0.25f, 1.0f),
+	vec4(0.25f, 0.80f, 0.35f, 1.0f),
+	vec4(0.85f, 0.85f, 0.30f, 1.0f)
+};
+
+static float ToMs(steady_clock::duration elapsed);
+
+//Writes ms with two decimals
+static string FormatMs(float ms);
+
+namespace CircuitGame::Graphics
+{
+	bool FrameProfiler::Initialize()
+	{
+		glGenQueries(
+			static_cast<GLsizei>(PROFILER_QUERY_SETS * GPU_PASS_COUNT),
+			&queries[0][0]);
+
+		isInitialized = true;
+		lastSummary = steady_clock::now();
+
+		Logger::Print(
+			"Initialized frame profiler!",
+			"FRAME_PROFILER",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+
+	void FrameProfiler::BeginFrame()
+	{
+		isFrameActive = isInitialized && isVisible;
+		if (!isFrameActive) return;
+
+		frame = {};
+		frameStart = steady_clock::now();
+
+		//the newest set may still be in flight, anything not available yet is picked up by a later frame
+		for (size_t set = 0; set < PROFILER_QUERY_SETS; set++)
+		{
+			for (size_t pass = 0; pass < GPU_PASS_COUNT; pass++)
+			{
+				if (!isQueryPending[set][pass]) continue;
+
+				GLuint isAvailable = 0;
+				glGetQueryObjectuiv(queries[set][pass], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+				if (!isAvailable) continue;
+
+				GLuint64 nanoseconds = 0;
+				glGetQueryObjectui64v(queries[set][pass], GL_QUERY_RESULT, &nanoseconds);
+				isQueryPending[set][pass] = false;
+
+				frame.gpuMs[pass] += static_cast<float>(nanoseconds) * 1e-6f;
+				summaryGpuSamples[pass]++;
+			}
+		}
+	}
+
+	void FrameProfiler::EndFrame()
+	{
+		if (!isFrameActive) return;
+		isFrameActive = false;
+
+		time_point<steady_clock> now = steady_clock::now();
+		frame.frameMs = ToMs(now - frameStart);
+
+		history[historyNext] = frame;
+		historyNext = (historyNext + 1) % PROFILER_HISTORY;
+
+		//the next drawn frame writes the other set while this one finishes on the GPU
+		if (isQuerySetUsed)
+		{
+			querySet = (querySet + 1) % PROFILER_QUERY_SETS;
+			isQuerySetUsed = false;
+		}
+
+		for (size_t scope = 0; scope < CPU_SCOPE_COUNT; scope++)
+		{
+			summarySum.cpuMs[scope] += frame.cpuMs[scope];
+		}
+		for (size_t pass = 0; pass < GPU_PASS_COUNT; pass++)
+		{
+			summarySum.gpuMs[pass] += frame.gpuMs[pass];
+		}
+		summarySum.frameMs += frame.frameMs;
+		summaryFrames++;
+
+		//the overlay has no text, so the numbers go to the log
+		if (now - lastSummary >= seconds(1))
+		{
+			float frames = static_cast<float>(summaryFrames);
+
+			string summary = "frame " + FormatMs(summarySum.frameMs / frames) + " ms | cpu";
+			for (size_t scope = 0; scope < CPU_SCOPE_COUNT; scope++)
+			{
+				summary += " " + string(cpuScopeNames[scope]) + " " + FormatMs(summarySum.cpuMs[scope] / frames);
+			}
+			summary += " | gpu";
+			for (size_t pass = 0; pass < GPU_PASS_COUNT; pass++)
+			{
+				float samples = static_cast<float>(summaryGpuSamples[pass]);
+				float average = samples > 0.0f ? summarySum.gpuMs[pass] / samples : 0.0f;
+				summary += " " + string(gpuPassNames[pass]) + " " + FormatMs(average);
+			}
+			summary += " (ms, average of " + to_string(summaryFrames) + " frames)";
+
+			Logger::Print(
+				summary,
+				"FRAME_PROFILER",
+				LogType::LOG_DEBUG);
+
+			summarySum = {};
+			summaryGpuSamples = {};
+			summaryFrames = 0;
+			lastSummary = now;
+		}
+
+		RedrawTracker::Request(RedrawReason::ui);
+	}
+
+	void FrameProfiler::BeginCpu(CpuScope scope)
+	{
+		if (!isFrameActive) return;
+
+		scopeStarts[static_cast<size_t>(scope)] = steady_clock::now();
+	}
+
+	void FrameProfiler::EndCpu(CpuScope scope)
+	{
+		if (!isFrameActive) return;
+
+		size_t index = static_cast<size_t>(scope);
+		frame.cpuMs[index] += ToMs(steady_clock::now() - scopeStarts[index]);
+	}
+
+	void FrameProfiler::BeginGpu(GpuPass pass)
+	{
+		if (!isFrameActive
+			|| isGpuPassActive)
+		{
+			return;
+		}
+
+		//a result nobody read yet is dropped, the timer starts over
+		size_t index = static_cast<size_t>(pass);
+		glBeginQuery(GL_TIME_ELAPSED, queries[querySet][index]);
+		isQueryPending[querySet][index] = true;
+
+		isQuerySetUsed = true;
+		isGpuPassActive = true;
+	}
+
+	void FrameProfiler::EndGpu()
+	{
+		if (!isGpuPassActive) return;
+
+		glEndQuery(GL_TIME_ELAPSED);
+		isGpuPassActive = false;
+	}
+
+	void FrameProfiler::Draw(const vec2& viewSize)
+	{
+		if (!isVisible) return;
+
+		float width = COLUMN_WIDTH * PROFILER_HISTORY;
+		if (viewSize.x < width + MARGIN * 2.0f
+			|| viewSize.y < GRAPH_HALF_HEIGHT * 2.0f + MARGIN * 2.0f)
+		{
+			return;
+		}
+
+		float left = MARGIN;
+		float baseline = viewSize.y - MARGIN - GRAPH_HALF_HEIGHT;
+		float top = baseline - GRAPH_HALF_HEIGHT;
+		float bottom = baseline + GRAPH_HALF_HEIGHT;
+		float pixelsPerMs = GRAPH_HALF_HEIGHT / GRAPH_MS;
+
+		Overlay::AddRect(
+			vec2(left, top),
+			vec2(left + width, bottom),
+			backgroundColor);
+
+		float referenceOffset = REFERENCE_MS * pixelsPerMs;
+		Overlay::AddLine(
+			vec2(left, baseline - referenceOffset),
+			vec2(left + width, baseline - referenceOffset),
+			referenceColor);
+		Overlay::AddLine(
+			vec2(left, baseline + referenceOffset),
+			vec2(left + width, baseline + referenceOffset),
+			referenceColor);
+
+		//oldest frame on the left
+		for (size_t column = 0; column < PROFILER_HISTORY; column++)
+		{
+			const ProfiledFrame& entry = history[(historyNext + column) % PROFILER_HISTORY];
+
+			float x0 = left + COLUMN_WIDTH * static_cast<float>(column);
+			float x1 = x0 + COLUMN_WIDTH;
+
+			float y = baseline;
+			for (size_t scope = 0; scope < CPU_SCOPE_COUNT && y > top; scope++)
+			{
+				float height = entry.cpuMs[scope] * pixelsPerMs;
+				if (height <= 0.0f) continue;
+
+				float nextY = max(y - height, top);
+				Overlay::AddRect(
+					vec2(x0, nextY),
+					vec2(x1, y),
+					cpuScopeColors[scope]);
+				y = nextY;
+			}
+
+			y = baseline;
+			for (size_t pass = 0; pass < GPU_PASS_COUNT && y < bottom; pass++)
+			{
+				float height = entry.gpuMs[pass] * pixelsPerMs;
+				if (height <= 0.0f) continue;
+
+				float nextY = min(y + height, bottom);
+				Overlay::AddRect(
+					vec2(x0, y),
+					vec2(x1, nextY),
+					gpuPassColors[pass]);
+				y = nextY;
+			}
+
+			//the gap between the stacked scopes and this mark is time spent sleeping or waiting
+			if (entry.frameMs > 0.0f)
+			{
+				float frameY = max(baseline - entry.frameMs * pixelsPerMs, top);
+				Overlay::AddLine(
+					vec2(x0, frameY),
+					vec2(x1, frameY),
+					frameColor);
+			}
+		}
+
+		Overlay::AddLine(
+			vec2(left, baseline),
+			vec2(left + width, baseline),
+			referenceColor);
+	}
+
+	void FrameProfiler::Shutdown()
+	{
+		if (!isInitialized) return;
+
+		if (isGpuPassActive) glEndQuery(GL_TIME_ELAPSED);
+
+		glDeleteQueries(
+			static_cast<GLsizei>(PROFILER_QUERY_SETS * GPU_PASS_COUNT),
+			&queries[0][0]);
+
+		for (size_t set = 0; set < PROFILER_QUERY_SETS; set++)
+		{
+			for (size_t pass = 0; pass < GPU_PASS_COUNT; pass++)
+			{
+				queries[set][pass] = 0;
+				isQueryPending[set][pass] = false;
+			}
+		}
+
+		isInitialized = false;
+		isFrameActive = false;
+		isGpuPassActive = false;
+		isQuerySetUsed = false;
+	}
+}
+
+float ToMs(steady_clock::duration elapsed)
+{
+	return duration<float, std::milli>(elapsed).count();
+}
+
+string FormatMs(float ms)
+{
+	char buffer[32];
+	snprintf(buffer, sizeof(buffer), "%.2f", ms);
+
+	return string(buffer);
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include "graphics/frustum.hpp"
+
+using CircuitGame::Graphics::Frustum;
+
+namespace CircuitGame::Graphics
+{
+	void Frustum::Update(const mat4& viewProjection)
+	{
+		//rows of the matrix, glm stores it column major
+		vec4 row[4]{};
+		for (int i = 0; i < 4; i++)
+		{
+			row[i] = vec4(
+				viewProjection[0][i],
+				viewProjection[1][i],
+				viewProjection[2][i],
+				viewProjection[3][i]);
+		}
+
+		//Gribb-Hartmann: -w <= x, y, z <= w in clip space
+		planes[0] = row[3] + row[0]; //left
+		planes[1] = row[3] - row[0]; //right
+		planes[2] = row[3] + row[1]; //bottom
+		planes[3] = row[3] - row[1]; //top
+		planes[4] = row[3] + row[2]; //near
+		planes[5] = row[3] - row[2]; //far
+	}
+
+	bool Frustum::Intersects(
+		const vec3& min,
+		const vec3& max) const
+	{
+		for (const vec4& plane : planes)
+		{
+			//the corner furthest along the plane normal, if even that is behind the plane the box is outside
+			vec3 corner(
+				plane.x >= 0.0f ? max.x : min.x,
+				plane.y >= 0.0f ? max.y : min.y,
+				plane.z >= 0.0f ? max.z : min.z);
+
+			if (plane.x * corner.x
+				+ plane.y * corner.y
+				+ plane.z * corner.z
+				+ plane.w < 0.0f)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
\ No newline at end of file
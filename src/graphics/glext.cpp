@@ -0,0 +1,137 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+using KalaWindow::Graphics::OpenGL::OpenGLCore;
+
+using CircuitGame::Graphics::GLExtensions;
+
+using std::string;
+
+void (K_APIENTRY* glEnable)(GLenum) = nullptr;
+void (K_APIENTRY* glBufferSubData)(GLenum, GLintptr, GLsizeiptr, const void*) = nullptr;
+void (K_APIENTRY* glVertexAttribDivisor)(GLuint, GLuint) = nullptr;
+void (K_APIENTRY* glVertexAttribIPointer)(GLuint, GLint, GLenum, GLsizei, const void*) = nullptr;
+void (K_APIENTRY* glDrawArraysInstanced)(GLenum, GLint, GLsizei, GLsizei) = nullptr;
+void (K_APIENTRY* glDrawElementsInstanced)(GLenum, GLsizei, GLenum, const void*, GLsizei) = nullptr;
+
+void (K_APIENTRY* glTexImage3D)(GLenum, GLint, GLint, GLsizei, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) = nullptr;
+void (K_APIENTRY* glTexSubImage3D)(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*) = nullptr;
+void (K_APIENTRY* glTexBuffer)(GLenum, GLenum, GLuint) = nullptr;
+void* (K_APIENTRY* glMapBufferRange)(GLenum, GLintptr, GLsizeiptr, GLbitfield) = nullptr;
+GLboolean (K_APIENTRY* glUnmapBuffer)(GLenum) = nullptr;
+
+void (K_APIENTRY* glFramebufferTextureLayer)(GLenum, GLenum, GLuint, GLint, GLint) = nullptr;
+void (K_APIENTRY* glBlitFramebuffer)(GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLint, GLbitfield, GLenum) = nullptr;
+void (K_APIENTRY* glDeleteFramebuffers)(GLsizei, const GLuint*) = nullptr;
+void (K_APIENTRY* glDeleteRenderbuffers)(GLsizei, const GLuint*) = nullptr;
+
+void (K_APIENTRY* glGenQueries)(GLsizei, GLuint*) = nullptr;
+void (K_APIENTRY* glDeleteQueries)(GLsizei, const GLuint*) = nullptr;
+void (K_APIENTRY* glBeginQuery)(GLenum, GLuint) = nullptr;
+void (K_APIENTRY* glEndQuery)(GLenum) = nullptr;
+void (K_APIENTRY* glGetQueryObjectuiv)(GLuint, GLenum, GLuint*) = nullptr;
+void (K_APIENTRY* glGetQueryObjectui64v)(GLuint, GLenum, GLuint64*) = nullptr;
+
+void (K_APIENTRY* glGetActiveUniform)(GLuint, GLuint, GLsizei, GLsizei*, GLint*, GLenum*, char*) = nullptr;
+GLuint (K_APIENTRY* glGetUniformBlockIndex)(GLuint, const char*) = nullptr;
+void (K_APIENTRY* glUniformBlockBinding)(GLuint, GLuint, GLuint) = nullptr;
+void (K_APIENTRY* glBindBufferBase)(GLenum, GLuint, GLuint) = nullptr;
+
+void (K_APIENTRY* glProgramParameteri)(GLuint, GLenum, GLint) = nullptr;
+void (K_APIENTRY* glGetProgramBinary)(GLuint, GLsizei, GLsizei*, GLenum*, void*) = nullptr;
+void (K_APIENTRY* glProgramBinary)(GLuint, GLenum, const void*, GLsizei) = nullptr;
+
+template<typename T>
+static bool LoadFunction(
+	T& function,
+	const char* name)
+{
+	function = reinterpret_cast<T>(OpenGLCore::GetGLProcAddress(name));
+	if (function != nullptr) return true;
+
+	Logger::Print(
+		"Failed to load OpenGL function '" + string(name) + "'!",
+		"GL_EXTENSIONS",
+		LogType::LOG_ERROR,
+		2);
+
+	return false;
+}
+
+namespace CircuitGame::Graphics
+{
+	bool GLExtensions::Initialize()
+	{
+		//no early out, so every missing function gets logged
+		bool isLoaded = true;
+
+		isLoaded &= LoadFunction(glEnable, "glEnable");
+		isLoaded &= LoadFunction(glBufferSubData, "glBufferSubData");
+		isLoaded &= LoadFunction(glVertexAttribDivisor, "glVertexAttribDivisor");
+		isLoaded &= LoadFunction(glVertexAttribIPointer, "glVertexAttribIPointer");
+		isLoaded &= LoadFunction(glDrawArraysInstanced, "glDrawArraysInstanced");
+		isLoaded &= LoadFunction(glDrawElementsInstanced, "glDrawElementsInstanced");
+
+		isLoaded &= LoadFunction(glTexImage3D, "glTexImage3D");
+		isLoaded &= LoadFunction(glTexSubImage3D, "glTexSubImage3D");
+		isLoaded &= LoadFunction(glTexBuffer, "glTexBuffer");
+		isLoaded &= LoadFunction(glMapBufferRange, "glMapBufferRange");
+		isLoaded &= LoadFunction(glUnmapBuffer, "glUnmapBuffer");
+
+		isLoaded &= LoadFunction(glFramebufferTextureLayer, "glFramebufferTextureLayer");
+		isLoaded &= LoadFunction(glBlitFramebuffer, "glBlitFramebuffer");
+		isLoaded &= LoadFunction(glDeleteFramebuffers, "glDeleteFramebuffers");
+		isLoaded &= LoadFunction(glDeleteRenderbuffers, "glDeleteRenderbuffers");
+
+		isLoaded &= LoadFunction(glGenQueries, "glGenQueries");
+		isLoaded &= LoadFunction(glDeleteQueries, "glDeleteQueries");
+		isLoaded &= LoadFunction(glBeginQuery, "glBeginQuery");
+		isLoaded &= LoadFunction(glEndQuery, "glEndQuery");
+		isLoaded &= LoadFunction(glGetQueryObjectuiv, "glGetQueryObjectuiv");
+		isLoaded &= LoadFunction(glGetQueryObjectui64v, "glGetQueryObjectui64v");
+
+		isLoaded &= LoadFunction(glGetActiveUniform, "glGetActiveUniform");
+		isLoaded &= LoadFunction(glGetUniformBlockIndex, "glGetUniformBlockIndex");
+		isLoaded &= LoadFunction(glUniformBlockBinding, "glUniformBlockBinding");
+		isLoaded &= LoadFunction(glBindBufferBase, "glBindBufferBase");
+
+		if (!isLoaded) return false;
+
+		//looked up without LoadFunction, a missing one is not an error
+		glProgramParameteri = reinterpret_cast<decltype(glProgramParameteri)>(
+			OpenGLCore::GetGLProcAddress("glProgramParameteri"));
+		glGetProgramBinary = reinterpret_cast<decltype(glGetProgramBinary)>(
+			OpenGLCore::GetGLProcAddress("glGetProgramBinary"));
+		glProgramBinary = reinterpret_cast<decltype(glProgramBinary)>(
+			OpenGLCore::GetGLProcAddress("glProgramBinary"));
+
+		GLint binaryFormats = 0;
+		if (glProgramParameteri != nullptr
+			&& glGetProgramBinary != nullptr
+			&& glProgramBinary != nullptr)
+		{
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormats);
+		}
+		hasProgramBinary = binaryFormats > 0;
+
+		Logger::Print(
+			"Loaded OpenGL extension functions!",
+			"GL_EXTENSIONS",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+}
\ No newline at end of file
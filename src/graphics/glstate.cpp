@@ -0,0 +1,188 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+
+using CircuitGame::Graphics::GLState;
+
+using std::array;
+using std::size_t;
+using std::vector;
+
+//program, vertex array and active unit are unknown until first set through GLState
+static constexpr GLuint UNKNOWN = UINT32_MAX;
+
+static constexpr size_t MAX_TEXTURE_UNITS = 16;
+static constexpr size_t TARGETS_PER_UNIT = 4;
+
+struct TextureBinding
+{
+	GLenum target{};
+	GLuint texture = UNKNOWN;
+};
+
+struct Capability
+{
+	GLenum capability{};
+	bool isEnabled{};
+};
+
+static GLuint program = UNKNOWN;
+static GLuint vertexArray = UNKNOWN;
+static GLuint activeUnit = UNKNOWN;
+
+static array<array<TextureBinding, TARGETS_PER_UNIT>, MAX_TEXTURE_UNITS> textures{};
+
+//capabilities missing here have never been set and are unknown
+static vector<Capability> capabilities{};
+
+namespace CircuitGame::Graphics
+{
+	bool GLState::UseShader(const ShaderProgram* shader)
+	{
+		GLuint programID = shader->GetProgramID();
+		if (programID == program)
+		{
+			frame.skipped++;
+			return true;
+		}
+
+		if (programID == 0) return false;
+
+		frame.issued++;
+		glUseProgram(programID);
+
+		program = programID;
+		return true;
+	}
+
+	void GLState::BindVertexArray(GLuint newVertexArray)
+	{
+		if (newVertexArray == vertexArray)
+		{
+			frame.skipped++;
+			return;
+		}
+
+		frame.issued++;
+		glBindVertexArray(newVertexArray);
+		vertexArray = newVertexArray;
+	}
+
+	void GLState::BindTexture(
+		GLuint unit,
+		GLenum target,
+		GLuint texture)
+	{
+		if (unit >= MAX_TEXTURE_UNITS) return;
+
+		//one slot per target, the first free slot is claimed by a target seen for the first time
+		TextureBinding* binding{};
+		for (auto& slot : textures[unit])
+		{
+			if (slot.target == target
+				|| slot.target == 0)
+			{
+				binding = &slot;
+				break;
+			}
+		}
+
+		if (binding != nullptr
+			&& binding->target == target
+			&& binding->texture == texture)
+		{
+			frame.skipped++;
+			return;
+		}
+
+		if (unit != activeUnit)
+		{
+			frame.issued++;
+			glActiveTexture(GL_TEXTURE0 + unit);
+			activeUnit = unit;
+		}
+
+		frame.issued++;
+		glBindTexture(target, texture);
+
+		//more targets than slots on one unit are simply not tracked
+		if (binding != nullptr)
+		{
+			binding->target = target;
+			binding->texture = texture;
+		}
+	}
+
+	void GLState::SetCapability(
+		GLenum capability,
+		bool isEnabled)
+	{
+		Capability* known{};
+		for (auto& entry : capabilities)
+		{
+			if (entry.capability == capability)
+			{
+				known = &entry;
+				break;
+			}
+		}
+
+		if (known != nullptr
+			&& known->isEnabled == isEnabled)
+		{
+			frame.skipped++;
+			return;
+		}
+
+		frame.issued++;
+		if (isEnabled) glEnable(capability);
+		else glDisable(capability);
+
+		if (known != nullptr) known->isEnabled = isEnabled;
+		else capabilities.push_back({ capability, isEnabled });
+	}
+
+	void GLState::OnVertexArrayDeleted(GLuint deletedVertexArray)
+	{
+		if (deletedVertexArray == vertexArray) vertexArray = 0;
+	}
+
+	void GLState::OnTextureDeleted(GLuint deletedTexture)
+	{
+		for (auto& unit : textures)
+		{
+			for (auto& slot : unit)
+			{
+				if (slot.texture == deletedTexture) slot.texture = 0;
+			}
+		}
+	}
+
+	void GLState::Invalidate()
+	{
+		program = UNKNOWN;
+		vertexArray = UNKNOWN;
+		activeUnit = UNKNOWN;
+
+		textures = {};
+		capabilities.clear();
+	}
+
+	void GLState::EndFrame()
+	{
+		lastFrame = frame;
+		frame = {};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cstddef>
+
+//kalawindow
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/instancebatch.hpp"
+#include "graphics/glext.hpp"
+
+using CircuitGame::Graphics::InstanceBatch;
+using CircuitGame::Graphics::InstanceData;
+
+using std::max;
+using std::min;
+
+//First vertex attribute location used by InstanceData
+static constexpr GLuint FIRST_INSTANCE_ATTRIBUTE = 3;
+
+namespace CircuitGame::Graphics
+{
+	InstanceBatch::InstanceBatch(
+		const ShaderProgram* shader,
+		const Texture* texture,
+		const MeshHandle& mesh) :
+		shader(shader),
+		texture(texture),
+		mesh(mesh)
+	{
+		glGenBuffers(1, &instanceVBO);
+	}
+
+	void InstanceBatch::Draw()
+	{
+		Draw(0, instances.size());
+	}
+
+	void InstanceBatch::Draw(
+		size_t first,
+		size_t count)
+	{
+		if (first >= instances.size()
+			|| mesh == nullptr)
+		{
+			return;
+		}
+
+		count = min(count, instances.size() - first);
+		if (count == 0) return;
+
+		//GL 3.3 has no base instance, so a range starts where the attributes point
+		size_t base = first * sizeof(InstanceData);
+
+		glBindBuffer(GL_ARRAY_BUFFER, instanceVBO);
+
+		if (isDirty) Upload();
+
+		//the mesh VAO may be shared by several batches,
+		//so the instance attributes are pointed at this batch's buffer every draw
+		for (GLuint i = 0; i < 4; i++)
+		{
+			GLuint location = FIRST_INSTANCE_ATTRIBUTE + i;
+
+			glVertexAttribPointer(
+				location,
+				4,
+				GL_FLOAT,
+				GL_FALSE,
+				sizeof(InstanceData),
+				(void*)(base + offsetof(InstanceData, model) + i * sizeof(vec4)));
+			glEnableVertexAttribArray(location);
+			glVertexAttribDivisor(location, 1);
+		}
+
+		GLuint colorLocation = FIRST_INSTANCE_ATTRIBUTE + 4;
+		glVertexAttribPointer(
+			colorLocation,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(InstanceData),
+			(void*)(base + offsetof(InstanceData, color)));
+		glEnableVertexAttribArray(colorLocation);
+		glVertexAttribDivisor(colorLocation, 1);
+
+		GLuint uvRectLocation = FIRST_INSTANCE_ATTRIBUTE + 5;
+		glVertexAttribPointer(
+			uvRectLocation,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(InstanceData),
+			(void*)(base + offsetof(InstanceData, uvRect)));
+		glEnableVertexAttribArray(uvRectLocation);
+		glVertexAttribDivisor(uvRectLocation, 1);
+
+		GLuint layerLocation = FIRST_INSTANCE_ATTRIBUTE + 6;
+		glVertexAttribPointer(
+			layerLocation,
+			1,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(InstanceData),
+			(void*)(base + offsetof(InstanceData, layer)));
+		glEnableVertexAttribArray(layerLocation);
+		glVertexAttribDivisor(layerLocation, 1);
+
+		//an integer attribute, a float could not hold every net index exactly
+		GLuint netLocation = FIRST_INSTANCE_ATTRIBUTE + 7;
+		glVertexAttribIPointer(
+			netLocation,
+			1,
+			GL_UNSIGNED_INT,
+			sizeof(InstanceData),
+			(void*)(base + offsetof(InstanceData, net)));
+		glEnableVertexAttribArray(netLocation);
+		glVertexAttribDivisor(netLocation, 1);
+
+		glDrawElementsInstanced(
+			GL_TRIANGLES,
+			mesh->GetIndexCount(),
+			GL_UNSIGNED_INT,
+			nullptr,
+			static_cast<GLsizei>(count));
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void InstanceBatch::Upload()
+	{
+		GLsizeiptr size = static_cast<GLsizeiptr>(instances.size() * sizeof(InstanceData));
+
+		if (instances.size() > instanceCapacity)
+		{
+			//grow geometrically so adding objects one by one does not reallocate every frame
+			instanceCapacity = max(instances.size(), instanceCapacity * 2);
+
+			glBufferData(
+				GL_ARRAY_BUFFER,
+				static_cast<GLsizeiptr>(instanceCapacity * sizeof(InstanceData)),
+				nullptr,
+				GL_DYNAMIC_DRAW);
+		}
+
+		glBufferSubData(
+			GL_ARRAY_BUFFER,
+			0,
+			size,
+			instances.data());
+
+		isDirty = false;
+	}
+
+	InstanceBatch::~InstanceBatch()
+	{
+		if (instanceVBO)
+		{
+			glDeleteBuffers(1, &instanceVBO);
+			instanceVBO = 0;
+		}
+	}
+}
\ No newline at end of file
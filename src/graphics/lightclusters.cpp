@@ -0,0 +1,415 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/lightclusters.hpp"
+#include "graphics/sceneuniforms.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::LightClusters;
+using CircuitGame::Graphics::PointLightData;
+using CircuitGame::Graphics::SceneUniforms;
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::CLUSTERS_X;
+using CircuitGame::Graphics::CLUSTERS_Y;
+using CircuitGame::Graphics::CLUSTERS_Z;
+using CircuitGame::Graphics::CLUSTER_COUNT;
+using CircuitGame::Graphics::LIGHT_TEXELS;
+
+using std::clamp;
+using std::floor;
+using std::log;
+using std::max;
+using std::min;
+using std::to_string;
+
+//Cluster coordinates of a light, first and last on each axis, an empty box if it reaches none
+struct ClusterBox
+{
+	uint32_t firstX;
+	uint32_t lastX;
+	uint32_t firstY;
+	uint32_t lastY;
+	uint32_t firstZ;
+	uint32_t lastZ;
+};
+
+//Finds the clusters the sphere of light can reach, returns false if it is outside the view volume
+static bool GetClusterBox(
+	const PointLightData& light,
+	const mat4& view,
+	const mat4& projection,
+	float nearPlane,
+	float farPlane,
+	float sliceScale,
+	ClusterBox& box);
+
+//Replaces the contents of a buffer texture's buffer
+static void UploadTexels(
+	GLuint buffer,
+	const void* data,
+	size_t size);
+
+//Creates a buffer and a buffer texture reading it as format
+static bool CreateTexelBuffer(
+	GLenum format,
+	GLuint unit,
+	GLuint& buffer,
+	GLuint& texture);
+
+namespace CircuitGame::Graphics
+{
+	bool LightClusters::Initialize()
+	{
+		glGetIntegerv(GL_MAX_TEXTURE_BUFFER_SIZE, &maxTexels);
+
+		if (!CreateTexelBuffer(GL_RGBA32F, CLUSTER_LIGHTS_TEXTURE_UNIT, lightBuffer, lightTexture)
+			|| !CreateTexelBuffer(GL_RG32UI, CLUSTER_RANGES_TEXTURE_UNIT, rangeBuffer, rangeTexture)
+			|| !CreateTexelBuffer(GL_R32UI, CLUSTER_INDICES_TEXTURE_UNIT, indexBuffer, indexTexture))
+		{
+			Logger::Print(
+				"Failed to create the light cluster buffers!",
+				"LIGHT_CLUSTERS",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		//every cluster starts out empty, so a frame drawn before the first Build shades no point light
+		ranges.assign(CLUSTER_COUNT * 2, 0);
+		UploadTexels(rangeBuffer, ranges.data(), ranges.size() * sizeof(uint32_t));
+
+		return true;
+	}
+
+	void LightClusters::Clear()
+	{
+		lights.clear();
+	}
+
+	void LightClusters::Submit(const PointLightData& light)
+	{
+		lights.push_back(light);
+	}
+
+	void LightClusters::Build()
+	{
+		const mat4& view = Camera::GetView();
+		const mat4& projection = Camera::GetProjection();
+
+		//recovered from the perspective matrix, so the slices always follow the camera's planes
+		float nearPlane = projection[3][2] / (projection[2][2] - 1.0f);
+		float farPlane = projection[3][2] / (projection[2][2] + 1.0f);
+		float sliceScale = static_cast<float>(CLUSTERS_Z) / log(farPlane / nearPlane);
+
+		clusterDepth = vec4(nearPlane, farPlane, sliceScale, 1.0f);
+		if (isEnabled) SceneUniforms::SetClusterDepth(clusterDepth);
+
+		size_t lightCount = lights.size();
+		size_t maxTexelCount = static_cast<size_t>(max(maxTexels, 0));
+		if (lightCount > maxTexelCount / LIGHT_TEXELS
+			&& !isOverflowLogged)
+		{
+			Logger::Print(
+				"Only '" + to_string(maxTexelCount / LIGHT_TEXELS) + "' of '" + to_string(lightCount)
+				+ "' point lights fit in a buffer texture, the rest are not shaded!",
+				"LIGHT_CLUSTERS",
+				LogType::LOG_WARNING);
+
+			isOverflowLogged = true;
+		}
+		lightCount = min(lightCount, maxTexelCount / LIGHT_TEXELS);
+
+		//counted first, then every cluster gets a range of one flat index list,
+		//the same layout the board uses for its fanout tables
+		ranges.assign(CLUSTER_COUNT * 2, 0);
+		bounds.resize(lightCount * 6);
+
+		size_t indexCount = 0;
+		for (size_t i = 0; i < lightCount; i++)
+		{
+			ClusterBox box{};
+			bool isVisible = GetClusterBox(
+				lights[i],
+				view,
+				projection,
+				nearPlane,
+				farPlane,
+				sliceScale,
+				box);
+
+			size_t volume = isVisible
+				? static_cast<size_t>(box.lastX - box.firstX + 1)
+				* (box.lastY - box.firstY + 1)
+				* (box.lastZ - box.firstZ + 1)
+				: 0;
+
+			//a light that does not fit the index list is left out as a whole
+			if (indexCount + volume > maxTexelCount)
+			{
+				if (!isOverflowLogged)
+				{
+					Logger::Print(
+						"Light cluster index list is full at '" + to_string(indexCount) + "' entries, some point lights are not shaded!",
+						"LIGHT_CLUSTERS",
+						LogType::LOG_WARNING);
+
+					isOverflowLogged = true;
+				}
+				volume = 0;
+			}
+
+			if (volume == 0)
+			{
+				//an empty box, first greater than last on every axis
+				box = { 1, 0, 1, 0, 1, 0 };
+			}
+
+			uint32_t* stored = &bounds[i * 6];
+			stored[0] = box.firstX;
+			stored[1] = box.lastX;
+			stored[2] = box.firstY;
+			stored[3] = box.lastY;
+			stored[4] = box.firstZ;
+			stored[5] = box.lastZ;
+
+			indexCount += volume;
+			for (uint32_t z = box.firstZ; z <= box.lastZ; z++)
+			{
+				for (uint32_t y = box.firstY; y <= box.lastY; y++)
+				{
+					for (uint32_t x = box.firstX; x <= box.lastX; x++)
+					{
+						ranges[((z * CLUSTERS_Y + y) * CLUSTERS_X + x) * 2 + 1]++;
+					}
+				}
+			}
+		}
+
+		uint32_t first = 0;
+		for (uint32_t cluster = 0; cluster < CLUSTER_COUNT; cluster++)
+		{
+			uint32_t count = ranges[cluster * 2 + 1];
+			ranges[cluster * 2] = first;
+			ranges[cluster * 2 + 1] = 0; //counts up again while filling
+			first += count;
+		}
+
+		indices.resize(indexCount);
+		for (uint32_t i = 0; i < lightCount; i++)
+		{
+			const uint32_t* box = &bounds[static_cast<size_t>(i) * 6];
+			if (box[0] > box[1]) continue;
+
+			for (uint32_t z = box[4]; z <= box[5]; z++)
+			{
+				for (uint32_t y = box[2]; y <= box[3]; y++)
+				{
+					for (uint32_t x = box[0]; x <= box[1]; x++)
+					{
+						uint32_t* range = &ranges[((z * CLUSTERS_Y + y) * CLUSTERS_X + x) * 2];
+						indices[range[0] + range[1]] = i;
+						range[1]++;
+					}
+				}
+			}
+		}
+
+		//must match FetchPointLight in the shaders
+		lightTexels.resize(lightCount * LIGHT_TEXELS);
+		for (size_t i = 0; i < lightCount; i++)
+		{
+			const PointLightData& light = lights[i];
+			vec4* texels = &lightTexels[i * LIGHT_TEXELS];
+
+			texels[0] = vec4(light.position, light.radius);
+			texels[1] = vec4(light.intensity, light.constant, light.linear, light.quadratic);
+			texels[2] = vec4(light.ambient, 0.0f);
+			texels[3] = vec4(light.diffuse, 0.0f);
+			texels[4] = vec4(light.specular, 0.0f);
+		}
+
+		UploadTexels(lightBuffer, lightTexels.data(), lightTexels.size() * sizeof(vec4));
+		UploadTexels(rangeBuffer, ranges.data(), ranges.size() * sizeof(uint32_t));
+		UploadTexels(indexBuffer, indices.data(), indices.size() * sizeof(uint32_t));
+	}
+
+	void LightClusters::Bind()
+	{
+		GLState::BindTexture(CLUSTER_LIGHTS_TEXTURE_UNIT, GL_TEXTURE_BUFFER, lightTexture);
+		GLState::BindTexture(CLUSTER_RANGES_TEXTURE_UNIT, GL_TEXTURE_BUFFER, rangeTexture);
+		GLState::BindTexture(CLUSTER_INDICES_TEXTURE_UNIT, GL_TEXTURE_BUFFER, indexTexture);
+	}
+
+	void LightClusters::SetEnabled(bool newIsEnabled)
+	{
+		isEnabled = newIsEnabled;
+		SceneUniforms::SetClusterDepth(isEnabled ? clusterDepth : vec4(0.0f));
+	}
+
+	void LightClusters::Shutdown()
+	{
+		GLuint textures[] = { lightTexture, rangeTexture, indexTexture };
+		for (GLuint texture : textures)
+		{
+			glDeleteTextures(1, &texture);
+			GLState::OnTextureDeleted(texture);
+		}
+
+		GLuint buffers[] = { lightBuffer, rangeBuffer, indexBuffer };
+		glDeleteBuffers(3, buffers);
+
+		lightBuffer = 0;
+		lightTexture = 0;
+		rangeBuffer = 0;
+		rangeTexture = 0;
+		indexBuffer = 0;
+		indexTexture = 0;
+
+		isEnabled = true;
+		isOverflowLogged = false;
+
+		lights.clear();
+		lightTexels.clear();
+		ranges.clear();
+		indices.clear();
+		bounds.clear();
+	}
+}
+
+bool GetClusterBox(
+	const PointLightData& light,
+	const mat4& view,
+	const mat4& projection,
+	float nearPlane,
+	float farPlane,
+	float sliceScale,
+	ClusterBox& box)
+{
+	if (light.radius <= 0.0f) return false;
+
+	vec3 center = vec3(view * vec4(light.position, 1.0f));
+	float depth = -center.z;
+
+	float minDepth = max(depth - light.radius, nearPlane);
+	float maxDepth = min(depth + light.radius, farPlane);
+	if (minDepth > maxDepth) return false;
+
+	auto getSlice = [nearPlane, sliceScale](float sliceDepth)
+		{
+			int slice = static_cast<int>(floor(log(sliceDepth / nearPlane) * sliceScale));
+			return static_cast<uint32_t>(clamp(slice, 0, static_cast<int>(CLUSTERS_Z) - 1));
+		};
+
+	//the sphere lies inside the box around it clipped to the depth range,
+	//and x / depth is largest and smallest at its corners, so they bound it on screen
+	auto getTiles = [minDepth, maxDepth](
+		float low,
+		float high,
+		float scale,
+		uint32_t tileCount,
+		uint32_t& first,
+		uint32_t& last)
+		{
+			float minNdc = min(low * scale / minDepth, low * scale / maxDepth);
+			float maxNdc = max(high * scale / minDepth, high * scale / maxDepth);
+			if (maxNdc < -1.0f
+				|| minNdc > 1.0f)
+			{
+				return false;
+			}
+
+			int lastTile = static_cast<int>(tileCount) - 1;
+			first = static_cast<uint32_t>(clamp(
+				static_cast<int>(floor((minNdc * 0.5f + 0.5f) * tileCount)),
+				0,
+				lastTile));
+			last = static_cast<uint32_t>(clamp(
+				static_cast<int>(floor((maxNdc * 0.5f + 0.5f) * tileCount)),
+				0,
+				lastTile));
+
+			return true;
+		};
+
+	if (!getTiles(
+		center.x - light.radius,
+		center.x + light.radius,
+		projection[0][0],
+		CLUSTERS_X,
+		box.firstX,
+		box.lastX)
+		|| !getTiles(
+		center.y - light.radius,
+		center.y + light.radius,
+		projection[1][1],
+		CLUSTERS_Y,
+		box.firstY,
+		box.lastY))
+	{
+		return false;
+	}
+
+	box.firstZ = getSlice(minDepth);
+	box.lastZ = getSlice(maxDepth);
+
+	return true;
+}
+
+void UploadTexels(
+	GLuint buffer,
+	const void* data,
+	size_t size)
+{
+	//a buffer texture needs storage before it can be sampled, an empty list uploads one zeroed texel
+	static const vec4 emptyTexel{};
+
+	glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+	glBufferData(
+		GL_TEXTURE_BUFFER,
+		static_cast<GLsizeiptr>(size > 0 ? size : sizeof(emptyTexel)),
+		size > 0 ? data : &emptyTexel,
+		GL_STREAM_DRAW);
+	glBindBuffer(GL_TEXTURE_BUFFER, 0);
+}
+
+bool CreateTexelBuffer(
+	GLenum format,
+	GLuint unit,
+	GLuint& buffer,
+	GLuint& texture)
+{
+	glGenBuffers(1, &buffer);
+	glGenTextures(1, &texture);
+	if (buffer == 0
+		|| texture == 0)
+	{
+		return false;
+	}
+
+	UploadTexels(buffer, nullptr, 0);
+
+	GLState::BindTexture(unit, GL_TEXTURE_BUFFER, texture);
+	glTexBuffer(GL_TEXTURE_BUFFER, format, buffer);
+
+	return true;
+}
\ No newline at end of file
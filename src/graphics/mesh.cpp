@@ -0,0 +1,204 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/mesh.hpp"
+#include "graphics/glext.hpp"
+#include "graphics/glstate.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::Mesh;
+using CircuitGame::Graphics::MeshHandle;
+using CircuitGame::Graphics::MeshRegistry;
+using CircuitGame::Graphics::MeshVertex;
+
+using std::make_shared;
+using std::string;
+using std::to_string;
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	Mesh::Mesh(
+		const string& name,
+		const vector<MeshVertex>& vertices,
+		const vector<uint32_t>& indices) :
+		name(name),
+		indexCount(static_cast<int>(indices.size()))
+	{
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+		glGenBuffers(1, &EBO);
+
+		GLState::BindVertexArray(VAO);
+
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			vertices.size() * sizeof(MeshVertex),
+			vertices.data(),
+			GL_STATIC_DRAW);
+
+		//the index buffer binding is part of the VAO state
+		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
+		glBufferData(
+			GL_ELEMENT_ARRAY_BUFFER,
+			indices.size() * sizeof(uint32_t),
+			indices.data(),
+			GL_STATIC_DRAW);
+
+		//position
+		glVertexAttribPointer(
+			0,
+			3,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(MeshVertex),
+			(void*)offsetof(MeshVertex, pos));
+		glEnableVertexAttribArray(0);
+
+		//normal
+		glVertexAttribPointer(
+			1,
+			3,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(MeshVertex),
+			(void*)offsetof(MeshVertex, normal));
+		glEnableVertexAttribArray(1);
+
+		//texture
+		glVertexAttribPointer(
+			2,
+			2,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(MeshVertex),
+			(void*)offsetof(MeshVertex, texCoords));
+		glEnableVertexAttribArray(2);
+
+		GLState::BindVertexArray(0);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		Logger::Print(
+			"Uploaded mesh '" + name + "' with '" + to_string(vertices.size()) + "' vertices and '"
+			+ to_string(indices.size()) + "' indices.",
+			"MESH",
+			LogType::LOG_DEBUG);
+	}
+
+	Mesh::~Mesh()
+	{
+		if (VAO)
+		{
+			glDeleteVertexArrays(1, &VAO);
+			GLState::OnVertexArrayDeleted(VAO);
+			VAO = 0;
+		}
+		if (VBO)
+		{
+			glDeleteBuffers(1, &VBO);
+			VBO = 0;
+		}
+		if (EBO)
+		{
+			glDeleteBuffers(1, &EBO);
+			EBO = 0;
+		}
+
+		Logger::Print(
+			"Destroyed mesh '" + name + "'!",
+			"MESH",
+			LogType::LOG_DEBUG);
+	}
+
+	MeshHandle MeshRegistry::Find(const string& name)
+	{
+		auto it = meshes.find(name);
+		if (it == meshes.end()) return nullptr;
+
+		return it->second.lock();
+	}
+
+	MeshHandle MeshRegistry::Create(
+		const string& name,
+		const vector<MeshVertex>& vertices,
+		const vector<uint32_t>& indices)
+	{
+		MeshHandle existing = Find(name);
+		if (existing != nullptr) return existing;
+
+		if (vertices.empty()
+			|| indices.empty())
+		{
+			Logger::Print(
+				"Cannot create mesh '" + name + "' without vertices or indices!",
+				"MESH",
+				LogType::LOG_ERROR,
+				2);
+
+			return nullptr;
+		}
+
+		MeshHandle mesh = make_shared<Mesh>(name, vertices, indices);
+		meshes[name] = mesh;
+
+		return mesh;
+	}
+
+	MeshHandle MeshRegistry::GetCube()
+	{
+		MeshHandle existing = Find("mesh_cube");
+		if (existing != nullptr) return existing;
+
+		//one face per entry: normal, then the tangent and bitangent spanning it
+		struct Face
+		{
+			vec3 normal;
+			vec3 right;
+			vec3 up;
+		};
+		const Face faces[] =
+		{
+			{ vec3( 0.0f,  0.0f, -1.0f), vec3(-1.0f,  0.0f,  0.0f), vec3(0.0f, 1.0f,  0.0f) },
+			{ vec3( 0.0f,  0.0f,  1.0f), vec3( 1.0f,  0.0f,  0.0f), vec3(0.0f, 1.0f,  0.0f) },
+			{ vec3(-1.0f,  0.0f,  0.0f), vec3( 0.0f,  0.0f,  1.0f), vec3(0.0f, 1.0f,  0.0f) },
+			{ vec3( 1.0f,  0.0f,  0.0f), vec3( 0.0f,  0.0f, -1.0f), vec3(0.0f, 1.0f,  0.0f) },
+			{ vec3( 0.0f, -1.0f,  0.0f), vec3( 1.0f,  0.0f,  0.0f), vec3(0.0f, 0.0f,  1.0f) },
+			{ vec3( 0.0f,  1.0f,  0.0f), vec3( 1.0f,  0.0f,  0.0f), vec3(0.0f, 0.0f, -1.0f) }
+		};
+
+		vector<MeshVertex> vertices{};
+		vector<uint32_t> indices{};
+
+		for (const Face& face : faces)
+		{
+			uint32_t first = static_cast<uint32_t>(vertices.size());
+			vec3 center = face.normal * 0.5f;
+
+			//counter-clockwise seen from outside
+			vertices.push_back({ center - face.right * 0.5f - face.up * 0.5f, face.normal, vec2(0.0f, 0.0f) });
+			vertices.push_back({ center + face.right * 0.5f - face.up * 0.5f, face.normal, vec2(1.0f, 0.0f) });
+			vertices.push_back({ center + face.right * 0.5f + face.up * 0.5f, face.normal, vec2(1.0f, 1.0f) });
+			vertices.push_back({ center - face.right * 0.5f + face.up * 0.5f, face.normal, vec2(0.0f, 1.0f) });
+
+			indices.insert(indices.end(), { first, first + 1, first + 2, first + 2, first + 3, first });
+		}
+
+		return Create("mesh_cube", vertices, indices);
+	}
+}
\ No newline at end of file
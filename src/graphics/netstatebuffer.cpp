@@ -0,0 +1,102 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstdint>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/netstatebuffer.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+#include "simulation/simulator.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::NetStateBuffer;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Simulation::Simulator;
+
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	bool NetStateBuffer::Initialize()
+	{
+		glGenBuffers(1, &buffer);
+		glGenTextures(1, &texture);
+
+		if (buffer == 0
+			|| texture == 0)
+		{
+			Logger::Print(
+				"Failed to create the net state buffer!",
+				"NET_STATE_BUFFER",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		//a buffer texture needs storage before it can be sampled, an empty board reads all zeroes
+		uploadedStates.assign(1, 0);
+
+		glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+		glBufferData(
+			GL_TEXTURE_BUFFER,
+			sizeof(uint32_t),
+			uploadedStates.data(),
+			GL_STREAM_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		GLState::BindTexture(NET_STATE_TEXTURE_UNIT, GL_TEXTURE_BUFFER, texture);
+		glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, buffer);
+
+		return true;
+	}
+
+	bool NetStateBuffer::Update()
+	{
+		const vector<uint32_t>* states = Simulator::TakeNetStates();
+		if (states == nullptr
+			|| states->empty()
+			|| *states == uploadedStates)
+		{
+			return false;
+		}
+
+		GLsizeiptr size = static_cast<GLsizeiptr>(states->size() * sizeof(uint32_t));
+
+		//respecifying the whole store orphans the old one, so a draw still reading
+		//last frame's states never stalls the upload, and the texture follows a resized board
+		glBindBuffer(GL_TEXTURE_BUFFER, buffer);
+		glBufferData(GL_TEXTURE_BUFFER, size, states->data(), GL_STREAM_DRAW);
+		glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+		uploadedStates = *states;
+
+		return true;
+	}
+
+	void NetStateBuffer::Bind()
+	{
+		GLState::BindTexture(NET_STATE_TEXTURE_UNIT, GL_TEXTURE_BUFFER, texture);
+	}
+
+	void NetStateBuffer::Shutdown()
+	{
+		glDeleteTextures(1, &texture);
+		GLState::OnTextureDeleted(texture);
+		glDeleteBuffers(1, &buffer);
+
+		texture = 0;
+		buffer = 0;
+		uploadedStates.clear();
+	}
+}
\ No newline at end of file
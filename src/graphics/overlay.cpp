@@ -0,0 +1,165 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstddef>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/overlay.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::Overlay;
+using CircuitGame::Graphics::OverlayVertex;
+
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	bool Overlay::Initialize(ShaderProgram* shader)
+	{
+		if (shader == nullptr)
+		{
+			Logger::Print(
+				"Cannot initialize overlay because its shader is nullptr!",
+				"OVERLAY",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		overlayShader = shader;
+
+		glGenVertexArrays(1, &VAO);
+		glGenBuffers(1, &VBO);
+
+		GLState::BindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+		//position
+		glVertexAttribPointer(
+			0,
+			2,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(OverlayVertex),
+			(void*)offsetof(OverlayVertex, pos));
+		glEnableVertexAttribArray(0);
+
+		//color
+		glVertexAttribPointer(
+			1,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(OverlayVertex),
+			(void*)offsetof(OverlayVertex, color));
+		glEnableVertexAttribArray(1);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		return true;
+	}
+
+	void Overlay::AddLine(
+		const vec2& from,
+		const vec2& to,
+		const vec4& color)
+	{
+		lineVertices.push_back({ from, color });
+		lineVertices.push_back({ to, color });
+	}
+
+	void Overlay::AddRect(
+		const vec2& min,
+		const vec2& max,
+		const vec4& color)
+	{
+		triangleVertices.push_back({ vec2(min.x, min.y), color });
+		triangleVertices.push_back({ vec2(max.x, min.y), color });
+		triangleVertices.push_back({ vec2(max.x, max.y), color });
+
+		triangleVertices.push_back({ vec2(max.x, max.y), color });
+		triangleVertices.push_back({ vec2(min.x, max.y), color });
+		triangleVertices.push_back({ vec2(min.x, min.y), color });
+	}
+
+	void Overlay::Draw()
+	{
+		if (VAO == 0
+			|| (triangleVertices.empty()
+			&& lineVertices.empty()))
+		{
+			return;
+		}
+
+		if (!GLState::UseShader(overlayShader)) return;
+
+		//lines go after the triangles in the same buffer
+		size_t triangleCount = triangleVertices.size();
+		triangleVertices.insert(
+			triangleVertices.end(),
+			lineVertices.begin(),
+			lineVertices.end());
+
+		GLState::BindVertexArray(VAO);
+		glBindBuffer(GL_ARRAY_BUFFER, VBO);
+
+		//respecified every frame and drawn once, the stream hint keeps the store in memory
+		//the driver can hand out anew while the previous frame still reads the old one
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			triangleVertices.size() * sizeof(OverlayVertex),
+			triangleVertices.data(),
+			GL_STREAM_DRAW);
+
+		if (triangleCount > 0)
+		{
+			glDrawArrays(
+				GL_TRIANGLES,
+				0,
+				static_cast<GLsizei>(triangleCount));
+		}
+		if (!lineVertices.empty())
+		{
+			glDrawArrays(
+				GL_LINES,
+				static_cast<GLint>(triangleCount),
+				static_cast<GLsizei>(lineVertices.size()));
+		}
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		triangleVertices.clear();
+		lineVertices.clear();
+	}
+
+	void Overlay::Shutdown()
+	{
+		if (VAO)
+		{
+			glDeleteVertexArrays(1, &VAO);
+			GLState::OnVertexArrayDeleted(VAO);
+			VAO = 0;
+		}
+		if (VBO)
+		{
+			glDeleteBuffers(1, &VBO);
+			VBO = 0;
+		}
+
+		triangleVertices.clear();
+		lineVertices.clear();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <vector>
+
+#include "graphics/probeview.hpp"
+#include "graphics/overlay.hpp"
+#include "simulation/simulator.hpp"
+
+using CircuitGame::Graphics::ProbeView;
+using CircuitGame::Graphics::Overlay;
+using CircuitGame::Simulation::Simulator;
+using CircuitGame::Simulation::ProbeLevel;
+
+using std::vector;
+
+static constexpr float MARGIN = 10.0f;
+static constexpr float ROW_HEIGHT = 24.0f;
+static constexpr float ROW_GAP = 6.0f;
+
+static const vec4 backgroundColor = vec4(0.05f, 0.05f, 0.05f, 1.0f);
+static const vec4 traceColor = vec4(0.2f, 0.9f, 0.3f, 1.0f);
+static const vec4 toggleColor = vec4(0.1f, 0.45f, 0.15f, 1.0f);
+
+namespace CircuitGame::Graphics
+{
+	void ProbeView::Draw(const vec2& viewSize)
+	{
+		if (!isVisible) return;
+
+		float width = viewSize.x - MARGIN * 2.0f;
+		if (width < 1.0f) return;
+
+		size_t pixelWidth = static_cast<size_t>(width);
+
+		static vector<ProbeLevel> columns{};
+
+		float top = MARGIN;
+		for (const auto& probe : Simulator::probes)
+		{
+			if (top + ROW_HEIGHT > viewSize.y) break;
+
+			float bottom = top + ROW_HEIGHT;
+			float highY = top + 2.0f;
+			float lowY = bottom - 2.0f;
+
+			Overlay::AddRect(
+				vec2(MARGIN, top),
+				vec2(MARGIN + width, bottom),
+				backgroundColor);
+
+			probe->Decimate(pixelWidth, columns);
+
+			//merge equal neighbouring columns so a quiet trace costs one line
+			size_t runStart = 0;
+			for (size_t column = 1; column <= pixelWidth; column++)
+			{
+				if (column < pixelWidth
+					&& columns[column] == columns[runStart])
+				{
+					continue;
+				}
+
+				float x0 = MARGIN + static_cast<float>(runStart);
+				float x1 = MARGIN + static_cast<float>(column);
+				ProbeLevel level = columns[runStart];
+
+				if (level == ProbeLevel::toggling)
+				{
+					Overlay::AddRect(
+						vec2(x0, highY),
+						vec2(x1, lowY),
+						toggleColor);
+				}
+				else
+				{
+					float y = level == ProbeLevel::high ? highY : lowY;
+					Overlay::AddLine(
+						vec2(x0, y),
+						vec2(x1, y),
+						traceColor);
+				}
+
+				//edge between a settled low and high run
+				if (column < pixelWidth
+					&& level != ProbeLevel::toggling
+					&& columns[column] != ProbeLevel::toggling)
+				{
+					Overlay::AddLine(
+						vec2(x1, highY),
+						vec2(x1, lowY),
+						traceColor);
+				}
+
+				runStart = column;
+			}
+
+			top = bottom + ROW_GAP;
+		}
+	}
+}
\ No newline at end of file
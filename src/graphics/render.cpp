@@ -11,7 +11,6 @@
 #include "graphics/window.hpp"
 #include "graphics/opengl/opengl.hpp"
 #include "graphics/opengl/opengl_core.hpp"
-#include "graphics/opengl/shader_opengl.hpp"
 #include "core/log.hpp"
 #include "core/core.hpp"
 
@@ -22,28 +21,88 @@
 #include "graphics/render.hpp"
 #include "graphics/texture.hpp"
 #include "gameobjects/cube.hpp"
+#include "gameobjects/pointlight.hpp"
+#include "gameobjects/dirlight.hpp"
+#include "graphics/overlay.hpp"
+#include "graphics/probeview.hpp"
+#include "graphics/glext.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/boardview.hpp"
+#include "graphics/instancebatch.hpp"
+#include "graphics/renderqueue.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/texturearray.hpp"
+#include "graphics/textureloader.hpp"
+#include "graphics/texturecache.hpp"
+#include "graphics/redrawtracker.hpp"
+#include "graphics/uniformcache.hpp"
+#include "graphics/sceneuniforms.hpp"
+#include "graphics/netstatebuffer.hpp"
+#include "graphics/wirerenderer.hpp"
+#include "graphics/boardimpostors.hpp"
+#include "graphics/lightclusters.hpp"
+#include "graphics/frameprofiler.hpp"
+#include "simulation/simulator.hpp"
+#include "core/trace.hpp"
 
 //kalawindow
 using KalaWindow::Graphics::Window;
 using KalaWindow::Graphics::OpenGL::Renderer_OpenGL;
 using KalaWindow::Graphics::OpenGL::OpenGLCore;
-using KalaWindow::Graphics::OpenGL::Shader_OpenGL;
-using KalaWindow::Graphics::OpenGL::ShaderStage;
-using KalaWindow::Graphics::OpenGL::ShaderType;
 using KalaWindow::Core::Logger;
 using KalaWindow::Core::LogType;
 using KalaWindow::Core::KalaWindowCore;
 
 using CircuitGame::GameObjects::GameObjectType;
 using CircuitGame::GameObjects::Cube;
+using CircuitGame::GameObjects::PointLight;
+using CircuitGame::GameObjects::DirLight;
 using CircuitGame::Graphics::Texture;
+using CircuitGame::Graphics::ShaderProgram;
 using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::Overlay;
+using CircuitGame::Graphics::ProbeView;
+using CircuitGame::Graphics::GLExtensions;
+using CircuitGame::Graphics::Camera;
+using CircuitGame::Graphics::BoardView;
+using CircuitGame::Graphics::InstanceBatch;
+using CircuitGame::Graphics::InstanceRange;
+using CircuitGame::Graphics::MeshRegistry;
+using CircuitGame::Graphics::MeshHandle;
+using CircuitGame::Graphics::RenderQueue;
+using CircuitGame::Graphics::RenderCommand;
+using CircuitGame::Graphics::RenderPass;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::TextureArray;
+using CircuitGame::Graphics::TextureLoader;
+using CircuitGame::Graphics::TextureCache;
+using CircuitGame::Graphics::SpriteSource;
+using CircuitGame::Graphics::RedrawTracker;
+using CircuitGame::Graphics::RedrawReason;
+using CircuitGame::Graphics::UniformCache;
+using CircuitGame::Graphics::SceneUniforms;
+using CircuitGame::Graphics::DirLightData;
+using CircuitGame::Graphics::NetStateBuffer;
+using CircuitGame::Graphics::WireRenderer;
+using CircuitGame::Graphics::BoardImpostors;
+using CircuitGame::Graphics::LightClusters;
+using CircuitGame::Graphics::FrameProfiler;
+using CircuitGame::Graphics::CpuScope;
+using CircuitGame::Graphics::GpuPass;
+using CircuitGame::Graphics::NET_STATE_TEXTURE_UNIT;
+using CircuitGame::Graphics::CLUSTER_LIGHTS_TEXTURE_UNIT;
+using CircuitGame::Graphics::CLUSTER_RANGES_TEXTURE_UNIT;
+using CircuitGame::Graphics::CLUSTER_INDICES_TEXTURE_UNIT;
+using CircuitGame::Simulation::Simulator;
 
 using glm::ortho;
 using glm::perspective;
 using glm::value_ptr;
 using std::string;
+using std::to_string;
 using std::vector;
+using std::unique_ptr;
+using std::make_unique;
 using std::filesystem::path;
 using std::filesystem::current_path;
 
@@ -51,11 +110,13 @@ static vec2 lastSize{};
 
 static Window* mainWindow{};
 
-struct TextureData
-{
-	string textureName;
-	string texturePath;
-};
+static bool wasIdle = false;
+
+//Isolated gate count of the last warning, new isolations are logged once they show up
+static uint32_t reportedIsolatedGates{};
+
+static RenderQueue renderQueue{};
+
 struct ShaderData
 {
 	string shaderName;
@@ -67,15 +128,20 @@ struct GameObjectData
 	string name;
 	GameObjectType type;
 	Texture* texture;
-	Shader_OpenGL* shader;
+	ShaderProgram* shader;
 };
 
-static bool InitializeTextures(const vector<TextureData>& textures);
 static bool InitializeShaders(const vector<ShaderData>& shaders);
 static bool CreateGameObjects(const vector<GameObjectData>& gameObjects);
 
 static void ResizeProjectionMatrix();
 
+//Creates the lights of the scene, they hand themselves to the light buffer and the clusters
+static void CreateSceneLights();
+
+//Material samplers and shininess never change, so they are set once after linking
+static void SetMaterialUniforms(const ShaderProgram* shader);
+
 namespace CircuitGame::Graphics
 {
 	bool Render::Initialize()
@@ -83,20 +149,34 @@ namespace CircuitGame::Graphics
 		mainWindow = Window::runtimeWindows.front();
 
 		if (!Renderer_OpenGL::Initialize(mainWindow)) return false;
+		if (!GLExtensions::Initialize()) return false;
+		if (!FrameProfiler::Initialize()) return false;
+		if (!SceneUniforms::Initialize()) return false;
+		if (!NetStateBuffer::Initialize()) return false;
+		if (!LightClusters::Initialize()) return false;
+
+		//decoded textures and linked programs are cached next to the game,
+		//a missing cache only costs startup time
+		TextureCache::Initialize((current_path() / "cache" / "textures").string());
+		ShaderProgram::InitializeCache((current_path() / "cache" / "programs").string());
+		if (!TextureLoader::Initialize()) return false;
+
+		GLState::SetCapability(GL_DEPTH_TEST, true);
 
 		mainWindow->SetRedrawCallback(Redraw);
 
 		mainWindow->SetResizeCallback(ResizeProjectionMatrix);
 		ResizeProjectionMatrix();
 
-		vector<TextureData> textures{};
-		TextureData textureData =
+		//every sprite shares one array texture, so switching sprites never rebinds a texture
+		vector<SpriteSource> sprites{};
+		SpriteSource cubeSprite =
 		{
 			.textureName = "texture_cube",
 			.texturePath = path(current_path() / "files" / "textures" / "cube.jpg").string()
 		};
-		textures.push_back(textureData);
-		if (!InitializeTextures(textures)) return false;
+		sprites.push_back(cubeSprite);
+		if (!TextureArray::Create("sprites", sprites)) return false;
 
 		vector<ShaderData> shaders{};
 		ShaderData shaderData =
@@ -106,8 +186,33 @@ namespace CircuitGame::Graphics
 			.fragPath = path(current_path() / "files" / "shaders" / "cube.frag").string()
 		};
 		shaders.push_back(shaderData);
+		ShaderData overlayShaderData =
+		{
+			.shaderName = "shader_overlay",
+			.vertPath = path(current_path() / "files" / "shaders" / "overlay.vert").string(),
+			.fragPath = path(current_path() / "files" / "shaders" / "overlay.frag").string()
+		};
+		shaders.push_back(overlayShaderData);
+		ShaderData wireShaderData =
+		{
+			.shaderName = "shader_wire",
+			.vertPath = path(current_path() / "files" / "shaders" / "wire.vert").string(),
+			.fragPath = path(current_path() / "files" / "shaders" / "wire.frag").string()
+		};
+		shaders.push_back(wireShaderData);
+		ShaderData impostorShaderData =
+		{
+			.shaderName = "shader_impostor",
+			.vertPath = path(current_path() / "files" / "shaders" / "impostor.vert").string(),
+			.fragPath = path(current_path() / "files" / "shaders" / "impostor.frag").string()
+		};
+		shaders.push_back(impostorShaderData);
 		if (!InitializeShaders(shaders)) return false;
 
+		SetMaterialUniforms(ShaderProgram::createdPrograms["shader_cube"].get());
+
+		if (!Overlay::Initialize(ShaderProgram::createdPrograms["shader_overlay"].get())) return false;
+
 		vector<GameObjectData> gameObjects{};
 
 		GameObjectData cubeData =
@@ -115,88 +220,344 @@ namespace CircuitGame::Graphics
 			.name = "cube_1",
 			.type = GameObjectType::cube,
 			.texture = Render::createdTextures["texture_cube"].get(),
-			.shader = Shader_OpenGL::createdShaders["shader_cube"].get()
+			.shader = ShaderProgram::createdPrograms["shader_cube"].get()
 		};
 		gameObjects.push_back(cubeData);
 		CreateGameObjects(gameObjects);
+		CreateSceneLights();
+
+		//every gate shares the cube mesh with the cubes above
+		if (!BoardView::Initialize(
+			ShaderProgram::createdPrograms["shader_cube"].get(),
+			ShaderProgram::createdPrograms["shader_wire"].get(),
+			ShaderProgram::createdPrograms["shader_impostor"].get(),
+			Render::createdTextures["texture_cube"].get(),
+			MeshRegistry::GetCube()))
+		{
+			return false;
+		}
 
 		return true;
 	}
 
-	void Render::Update()
+	bool Render::Update()
 	{
-		if (!mainWindow->IsIdle()) Redraw();
+		TRACE_ZONE("Render::Update");
+
+		FrameProfiler::BeginCpu(CpuScope::uploads);
+
+		//swaps in finished textures, each swap requests a redraw
+		TextureLoader::Update();
+
+		FrameProfiler::EndCpu(CpuScope::uploads);
+		FrameProfiler::BeginCpu(CpuScope::simulation);
+
+		//drain even while hidden or unchanged so the probe rings never fill up
+		if (Simulator::DrainProbes()
+			&& ProbeView::IsVisible())
+		{
+			RedrawTracker::Request(RedrawReason::simulation);
+		}
+
+		//uploaded even while hidden, so the first frame after uncovering the window is current
+		if (NetStateBuffer::Update())
+		{
+			RedrawTracker::Request(RedrawReason::simulation);
+			BoardImpostors::MarkStale();
+		}
+
+		//the simulation thread must not log, so the loops it isolated are reported from here
+		uint32_t isolatedGates = Simulator::GetIsolatedGateCount();
+		if (isolatedGates > reportedIsolatedGates)
+		{
+			Logger::Print(
+				"Isolated '" + to_string(isolatedGates - reportedIsolatedGates) + "' gates of loops that did not settle within '"
+				+ to_string(Simulator::board.GetDeltaCycleBudget()) + "' delta cycles, '"
+				+ to_string(Simulator::GetOscillatingNetCount()) + "' nets are now flagged as oscillating!",
+				"BOARD",
+				LogType::LOG_WARNING);
+		}
+
+		//a recompiled board starts over from zero
+		reportedIsolatedGates = isolatedGates;
+
+		FrameProfiler::EndCpu(CpuScope::simulation);
+		FrameProfiler::BeginCpu(CpuScope::uploads);
+
+		//may frame the camera on a new board, so it runs before anything is culled
+		BoardView::Refresh();
+
+		//only the wire chunks touched by an edit are uploaded again
+		if (WireRenderer::Update()) RedrawTracker::Request(RedrawReason::scene);
+
+		FrameProfiler::EndCpu(CpuScope::uploads);
+
+		bool isIdle = mainWindow->IsIdle();
+		if (isIdle) wasIdle = true;
+		else if (wasIdle)
+		{
+			//the window may have been uncovered or restored, its contents are stale
+			wasIdle = false;
+			RedrawTracker::Request(RedrawReason::ui);
+		}
+
+		if (isIdle
+			|| !RedrawTracker::IsPending())
+		{
+			return false;
+		}
+
+		//impostors are rendered offscreen before the frame that shows them,
+		//the ones left stale by the budget are refreshed by the following frames
+		FrameProfiler::BeginCpu(CpuScope::impostors);
+		FrameProfiler::BeginGpu(GpuPass::impostors);
+
+		bool hasStaleImpostors = BoardImpostors::Update();
+
+		FrameProfiler::EndGpu();
+		FrameProfiler::EndCpu(CpuScope::impostors);
+
+		Redraw();
+
+		if (hasStaleImpostors) RedrawTracker::Request(RedrawReason::scene);
+		return true;
 	}
 
 	void Render::Redraw()
 	{
+		TRACE_ZONE("Render::Redraw");
+
 		glClearColor(0.1f, 0.1f, 0.1f, 1.0f); //dark gray
-		glClear(GL_COLOR_BUFFER_BIT);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		GLState::SetCapability(GL_DEPTH_TEST, true);
+
+		FrameProfiler::BeginCpu(CpuScope::instanceBuild);
 
+		for (const auto& batch : frameBatches)
+		{
+			batch->Clear();
+		}
+
+		//objects only queue their instances, nothing is drawn per object
 		for (const auto& object : runtimeCubes)
 		{
 			object->Render();
 		}
 
+		//lights are gathered again every frame and sorted into the clusters of the current camera
+		LightClusters::Clear();
+		for (const auto& light : runtimeDirLights)
+		{
+			light->Render();
+		}
+		for (const auto& light : runtimePointLights)
+		{
+			light->Render();
+		}
+		LightClusters::Build();
+
+		renderQueue.Clear();
+
+		auto makeKey = [](const InstanceBatch* batch)
+			{
+				const Texture* texture = batch->GetTexture();
+
+				return RenderQueue::MakeKey(
+					RenderPass::opaque,
+					batch->GetShader()->GetProgramID(),
+					texture != nullptr ? texture->GetTextureID() : 0,
+					batch->GetMesh()->GetVAO());
+			};
+
+		//frame batches only hold objects that already passed culling in their Render call
+		for (const auto& batch : frameBatches)
+		{
+			if (batch->GetInstanceCount() == 0) continue;
+
+			renderQueue.Add(makeKey(batch.get()), batch.get());
+		}
+
+		//zoomed out, one impostor quad per chunk replaces the gates and wires
+		bool isOverview = BoardImpostors::IsActive();
+
+		InstanceBatch* boardBatch = BoardView::GetBatch();
+		if (!isOverview
+			&& boardBatch != nullptr
+			&& boardBatch->GetInstanceCount() > 0)
+		{
+			FrameProfiler::EndCpu(CpuScope::instanceBuild);
+			FrameProfiler::BeginCpu(CpuScope::culling);
+
+			BoardView::Cull(Camera::GetFrustum());
+
+			FrameProfiler::EndCpu(CpuScope::culling);
+			FrameProfiler::BeginCpu(CpuScope::instanceBuild);
+
+			uint64_t key = makeKey(boardBatch);
+			for (const InstanceRange& range : BoardView::GetVisibleRanges())
+			{
+				renderQueue.Add(
+					key,
+					boardBatch,
+					range.first,
+					range.count);
+			}
+		}
+
+		renderQueue.Sort();
+		TRACE_COUNTER("draw commands", renderQueue.GetCommands().size());
+
+		FrameProfiler::EndCpu(CpuScope::instanceBuild);
+		FrameProfiler::BeginCpu(CpuScope::submit);
+		FrameProfiler::BeginGpu(GpuPass::scene);
+
+		//camera and lights are shared by every program, switching programs costs no uniform uploads
+		SceneUniforms::Upload();
+		NetStateBuffer::Bind();
+		LightClusters::Bind();
+
+		//in key order the state cache skips every bind inside a run of commands sharing it
+		for (const RenderCommand& command : renderQueue.GetCommands())
+		{
+			InstanceBatch* batch = command.batch;
+			const Texture* texture = batch->GetTexture();
+
+			if (!GLState::UseShader(batch->GetShader())) continue;
+
+			GLState::BindTexture(
+				0,
+				texture != nullptr ? texture->GetTarget() : GL_TEXTURE_2D_ARRAY,
+				texture != nullptr ? texture->GetTextureID() : 0);
+			GLState::BindVertexArray(batch->GetMesh()->GetVAO());
+
+			batch->Draw(command.first, command.count);
+		}
+
+		FrameProfiler::EndGpu();
+		FrameProfiler::EndCpu(CpuScope::submit);
+		FrameProfiler::BeginCpu(CpuScope::culling);
+
+		if (isOverview) BoardImpostors::Cull(Camera::GetFrustum());
+		else WireRenderer::Cull(Camera::GetFrustum());
+
+		FrameProfiler::EndCpu(CpuScope::culling);
+		FrameProfiler::BeginCpu(CpuScope::submit);
+		FrameProfiler::BeginGpu(GpuPass::board);
+
+		if (isOverview) BoardImpostors::Draw();
+		else WireRenderer::Draw();
+
+		FrameProfiler::EndGpu();
+		FrameProfiler::BeginGpu(GpuPass::overlay);
+
+		//the overlay always stays on top of the scene
+		GLState::SetCapability(GL_DEPTH_TEST, false);
+
+		vec2 viewSize = mainWindow->GetSize();
+		ProbeView::Draw(viewSize);
+		FrameProfiler::Draw(viewSize);
+		Overlay::Draw();
+
+		FrameProfiler::EndGpu();
+		FrameProfiler::EndCpu(CpuScope::submit);
+		FrameProfiler::BeginCpu(CpuScope::swap);
+
 		Renderer_OpenGL::SwapOpenGLBuffers(mainWindow);
+
+		FrameProfiler::EndCpu(CpuScope::swap);
+
+		GLState::EndFrame();
+		RedrawTracker::Clear();
+	}
+
+	InstanceBatch* Render::GetFrameBatch(
+		const ShaderProgram* shader,
+		const Texture* texture,
+		const MeshHandle& mesh)
+	{
+		//only a handful of shader, texture and mesh combinations exist, a linear search is enough.
+		//Sprites of one texture array share a batch, their instances carry the region.
+		for (const auto& batch : frameBatches)
+		{
+			const Texture* batchTexture = batch->GetTexture();
+			bool isSameTexture = batchTexture == texture
+				|| (batchTexture != nullptr
+				&& texture != nullptr
+				&& batchTexture->GetTextureID() == texture->GetTextureID());
+
+			if (batch->GetShader() == shader
+				&& isSameTexture
+				&& batch->GetMesh() == mesh.get())
+			{
+				return batch.get();
+			}
+		}
+
+		frameBatches.push_back(make_unique<InstanceBatch>(
+			shader,
+			texture,
+			mesh));
+
+		return frameBatches.back().get();
 	}
 
 	void Render::Shutdown()
 	{
+		//stops the decode threads before the textures they write to are destroyed
+		TextureLoader::Shutdown();
+
 		for (const auto& obj : runtimeCubes)
 		{
 			obj->SetUpdate(false);
 		}
+		for (const auto& light : runtimePointLights)
+		{
+			light->SetUpdate(false);
+		}
+		for (const auto& light : runtimeDirLights)
+		{
+			light->SetUpdate(false);
+		}
+
+		Overlay::Shutdown();
+		BoardView::Shutdown();
+		SceneUniforms::Shutdown();
+		NetStateBuffer::Shutdown();
+		LightClusters::Shutdown();
+		FrameProfiler::Shutdown();
+		TextureArray::Shutdown();
+		frameBatches.clear();
 
 		createdTextures.clear();
 		createdCubes.clear();
-	}
-}
-
-bool InitializeTextures(const vector<TextureData>& textures)
-{
-	for (const auto& texture : textures)
-	{
-		string textureName = texture.textureName;
-		string texturePath = texture.texturePath;
+		createdPointLights.clear();
+		createdDirLights.clear();
+		runtimeCubes.clear();
+		runtimePointLights.clear();
+		runtimeDirLights.clear();
 
-		Texture* tex = Texture::CreateTexture(
-			textureName,
-			texturePath);
+		for (const auto& [name, program] : ShaderProgram::createdPrograms)
+		{
+			UniformCache::Unregister(program->GetProgramID());
+		}
+		ShaderProgram::createdPrograms.clear();
 	}
-
-	return true;
 }
 
 bool InitializeShaders(const vector<ShaderData>& shaders)
 {
 	for (const auto& shader : shaders)
 	{
-		string shaderName = shader.shaderName;
+		ShaderProgram* createdShader = ShaderProgram::Create(
+			shader.shaderName,
+			shader.vertPath,
+			shader.fragPath);
 
-		string vertPath = shader.vertPath;
-		string fragPath = shader.fragPath;
-		struct ShaderStage vertStage
-		{
-			.shaderType = ShaderType::Shader_Vertex,
-			.shaderPath = vertPath
-		};
-		struct ShaderStage fragStage
-		{
-			.shaderType = ShaderType::Shader_Fragment,
-			.shaderPath = fragPath
-		};
+		if (createdShader == nullptr) return false;
 
-		vector<ShaderStage> stages
-		{
-			vertStage,
-			fragStage
-		};
-
-		Shader_OpenGL* shader = Shader_OpenGL::CreateShader(
-			shaderName,
-			stages,
-			mainWindow);
+		//every uniform location is resolved once, right after linking
+		UniformCache::Register(createdShader->GetProgramID());
 	}
 
 	return true;
@@ -219,66 +580,40 @@ bool CreateGameObjects(const vector<GameObjectData>& gameObjects)
 
 void ResizeProjectionMatrix()
 {
-	/*
-	
-	//TODO: FIX THIS
-
-	Shader_OpenGL* shader = Cube::GetCubeShader();
-	if (!shader) return;
-
-	vec2 framebufferSize = mainWindow->GetSize();
-	float aspect = framebufferSize.x / framebufferSize.y;
-
-	float orthoWidth = 1.0f;
-	float orthoHeight = 1.0f;
-
-	if (aspect >= 1.0f) orthoWidth = aspect;
-	else orthoHeight = 1.0f / aspect;
-
-	mat4 proj = ortho(
-		-orthoWidth, orthoWidth,
-		-orthoHeight, orthoHeight,
-		-1.0f, 1.0f);
-
-	mat4 model = mat4(1.0f);
-
-	GLuint program = shader->GetProgramID();
-	glUseProgram(program);
-
-	//upload projection
-
-	int projLoc = glGetUniformLocation(program, "uProjection");
-
-	//Logger::Print(
-	//	  "uProjection uniform location: " + to_string(projLoc),
-	//	  "Render",
-	//	  LogType::LOG_DEBUG);
+	Camera::SetViewSize(mainWindow->GetSize());
+}
 
-	if (projLoc >= 0)
-	{
-		glUniformMatrix4fv(
-			projLoc,
-			1,
-			GL_FALSE,
-			value_ptr(proj));
-	}
+void CreateSceneLights()
+{
+	//a single light from the camera side lights the whole board
+	DirLightData sun{};
+	sun.direction = vec3(-0.3f, -0.5f, -1.0f);
+	sun.intensity = vec3(1.0f);
+	sun.ambient = vec3(0.35f);
+	sun.diffuse = vec3(0.65f);
+	sun.specular = vec3(0.2f);
+	DirLight::Initialize("dirlight_sun", sun);
+
+	//a warm glow next to the cube, fragments further than its radius never shade it
+	PointLight::Initialize(
+		"pointlight_1",
+		vec3(-3.5f, 1.5f, 1.5f),
+		vec3(1.0f, 0.8f, 0.6f),
+		0.8f,
+		4.0f);
+}
 
-	//upload model
+void SetMaterialUniforms(const ShaderProgram* shader)
+{
+	if (!GLState::UseShader(shader)) return;
 
-	int modelLoc = glGetUniformLocation(program, "uModel");
-	
-	//Logger::Print(
-	//	  "uModel uniform location: " + to_string(modelLoc),
-	//	  "Render",
-	//	  LogType::LOG_DEBUG);
+	unsigned int programID = shader->GetProgramID();
 
-	if (modelLoc >= 0)
-	{
-		glUniformMatrix4fv(
-			modelLoc,
-			1,
-			GL_FALSE,
-			value_ptr(model));
-	}
-	*/
+	UniformCache::SetInt(programID, "material.diffuse", 0);
+	UniformCache::SetInt(programID, "material.specular", 0);
+	UniformCache::SetFloat(programID, "material.shininess", 32.0f);
+	UniformCache::SetInt(programID, "netStates", NET_STATE_TEXTURE_UNIT);
+	UniformCache::SetInt(programID, "clusterLights", CLUSTER_LIGHTS_TEXTURE_UNIT);
+	UniformCache::SetInt(programID, "clusterRanges", CLUSTER_RANGES_TEXTURE_UNIT);
+	UniformCache::SetInt(programID, "clusterIndices", CLUSTER_INDICES_TEXTURE_UNIT);
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstddef>
+#include <vector>
+
+#include "graphics/renderqueue.hpp"
+
+using CircuitGame::Graphics::RenderQueue;
+using CircuitGame::Graphics::RenderCommand;
+using CircuitGame::Graphics::RenderPass;
+
+using std::size_t;
+
+static constexpr uint64_t FIELD_MASK = 0xFFFFF;
+
+namespace CircuitGame::Graphics
+{
+	uint64_t RenderQueue::MakeKey(
+		RenderPass pass,
+		uint32_t shaderID,
+		uint32_t textureID,
+		uint32_t meshID)
+	{
+		return (static_cast<uint64_t>(pass) << 60)
+			| ((shaderID & FIELD_MASK) << 40)
+			| ((textureID & FIELD_MASK) << 20)
+			| (meshID & FIELD_MASK);
+	}
+
+	void RenderQueue::Sort()
+	{
+		size_t count = commands.size();
+		if (count < 2) return;
+
+		scratch.resize(count);
+
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			size_t offsets[256]{};
+			for (const RenderCommand& command : commands)
+			{
+				offsets[(command.key >> shift) & 0xFF]++;
+			}
+
+			//every key has the same byte here, the order would not change
+			if (offsets[(commands[0].key >> shift) & 0xFF] == count) continue;
+
+			size_t sum = 0;
+			for (size_t& offset : offsets)
+			{
+				size_t bucketSize = offset;
+				offset = sum;
+				sum += bucketSize;
+			}
+
+			for (const RenderCommand& command : commands)
+			{
+				scratch[offsets[(command.key >> shift) & 0xFF]++] = command;
+			}
+
+			commands.swap(scratch);
+		}
+	}
+}
\ No newline at end of file
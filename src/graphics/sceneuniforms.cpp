@@ -0,0 +1,150 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <string>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/sceneuniforms.hpp"
+#include "graphics/camera.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::SceneUniforms;
+using CircuitGame::Graphics::CameraData;
+using CircuitGame::Graphics::DirLightData;
+using CircuitGame::Graphics::Camera;
+
+static GLuint CreateBlockBuffer(
+	GLsizeiptr size,
+	GLuint binding);
+
+namespace CircuitGame::Graphics
+{
+	bool SceneUniforms::Initialize()
+	{
+		cameraBuffer = CreateBlockBuffer(sizeof(CameraData), CAMERA_BLOCK_BINDING);
+		lightsBuffer = CreateBlockBuffer(sizeof(LightsData), LIGHTS_BLOCK_BINDING);
+
+		if (cameraBuffer == 0
+			|| lightsBuffer == 0)
+		{
+			Logger::Print(
+				"Failed to create the scene uniform buffers!",
+				"SCENE_UNIFORMS",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		isLightsDirty = true;
+
+		return true;
+	}
+
+	void SceneUniforms::BindBlocks(GLuint program)
+	{
+		GLuint cameraIndex = glGetUniformBlockIndex(program, "Camera");
+		if (cameraIndex != GL_INVALID_INDEX)
+		{
+			glUniformBlockBinding(program, cameraIndex, CAMERA_BLOCK_BINDING);
+		}
+
+		GLuint lightsIndex = glGetUniformBlockIndex(program, "Lights");
+		if (lightsIndex != GL_INVALID_INDEX)
+		{
+			glUniformBlockBinding(program, lightsIndex, LIGHTS_BLOCK_BINDING);
+		}
+	}
+
+	void SceneUniforms::SetDirLight(const DirLightData& light)
+	{
+		lights.dirLight = light;
+		isLightsDirty = true;
+	}
+
+	void SceneUniforms::SetClusterDepth(const vec4& depth)
+	{
+		if (lights.clusterDepth == depth) return;
+
+		lights.clusterDepth = depth;
+		isLightsDirty = true;
+	}
+
+	void SceneUniforms::Upload()
+	{
+		vec2 viewSize = Camera::GetViewSize();
+
+		CameraData camera =
+		{
+			.view = Camera::GetView(),
+			.projection = Camera::GetProjection(),
+			.position = vec4(Camera::GetPosition(), 1.0f),
+			.viewSize = vec4(viewSize, 1.0f / viewSize.x, 1.0f / viewSize.y)
+		};
+
+		Upload(camera);
+	}
+
+	void SceneUniforms::Upload(const CameraData& camera)
+	{
+		if (cameraBuffer == 0) return;
+
+		glBindBuffer(GL_UNIFORM_BUFFER, cameraBuffer);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(CameraData), &camera);
+
+		if (isLightsDirty)
+		{
+			glBindBuffer(GL_UNIFORM_BUFFER, lightsBuffer);
+			glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(LightsData), &lights);
+
+			isLightsDirty = false;
+		}
+
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+	}
+
+	void SceneUniforms::Shutdown()
+	{
+		if (cameraBuffer)
+		{
+			glDeleteBuffers(1, &cameraBuffer);
+			cameraBuffer = 0;
+		}
+		if (lightsBuffer)
+		{
+			glDeleteBuffers(1, &lightsBuffer);
+			lightsBuffer = 0;
+		}
+	}
+}
+
+GLuint CreateBlockBuffer(
+	GLsizeiptr size,
+	GLuint binding)
+{
+	GLuint buffer{};
+	glGenBuffers(1, &buffer);
+	if (buffer == 0) return 0;
+
+	glBindBuffer(GL_UNIFORM_BUFFER, buffer);
+	glBufferData(
+		GL_UNIFORM_BUFFER,
+		size,
+		nullptr,
+		GL_DYNAMIC_DRAW);
+	glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	//the buffer stays on its binding point for the lifetime of the program
+	glBindBufferBase(GL_UNIFORM_BUFFER, binding, buffer);
+
+	return buffer;
+}
\ No newline at end of file
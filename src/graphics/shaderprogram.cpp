@@ -0,0 +1,372 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/shaderprogram.hpp"
+#include "graphics/glext.hpp"
+#include "core/diskcache.hpp"
+#include "core/hash.hpp"
+#include "core/trace.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::ShaderProgram;
+using CircuitGame::Graphics::GLExtensions;
+using CircuitGame::Core::DiskCache;
+using CircuitGame::Core::MappedFile;
+using CircuitGame::Core::HashString;
+
+using std::memcpy;
+using std::ifstream;
+using std::ostringstream;
+using std::make_unique;
+using std::move;
+using std::unique_ptr;
+using std::string;
+using std::to_string;
+using std::vector;
+
+static constexpr uint32_t CACHE_MAGIC = 0x42504743; //"CGPB"
+static constexpr uint32_t CACHE_VERSION = 1;
+
+//Fixed-size start of every cached program, followed by the driver binary
+struct ProgramHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t binaryFormat;
+	uint32_t binaryLength;
+};
+
+static bool ReadSource(
+	const string& sourcePath,
+	string& source);
+
+//Returns the shader object, or 0 after logging the compiler output
+static GLuint CompileStage(
+	GLenum type,
+	const string& source,
+	const string& sourcePath);
+
+//Loads the cached binary of programName and key into program, false if there is none or the driver rejects it
+static bool RestoreBinary(
+	DiskCache& cache,
+	const string& programName,
+	uint64_t key,
+	GLuint program);
+
+static bool IsLinked(GLuint program);
+
+namespace CircuitGame::Graphics
+{
+	bool ShaderProgram::InitializeCache(const string& directory)
+	{
+		if (!GLExtensions::HasProgramBinary())
+		{
+			Logger::Print(
+				"The driver cannot return program binaries, shaders are compiled on every launch.",
+				"SHADER_PROGRAM",
+				LogType::LOG_WARNING);
+
+			return false;
+		}
+
+		string error{};
+		if (!cache.Initialize(directory, ".cgprog", error))
+		{
+			Logger::Print(
+				"Failed to create program cache directory '" + directory + "', shaders are compiled on every launch! Reason: "
+				+ error,
+				"SHADER_PROGRAM",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		//a driver update may change the binary format without changing the format enum
+		auto getString = [](GLenum name)
+			{
+				const GLubyte* value = glGetString(name);
+				return value != nullptr
+					? string(reinterpret_cast<const char*>(value))
+					: string{};
+			};
+		driver = getString(GL_VENDOR) + "|" + getString(GL_RENDERER) + "|" + getString(GL_VERSION);
+
+		return true;
+	}
+
+	ShaderProgram* ShaderProgram::Create(
+		const string& programName,
+		const string& vertPath,
+		const string& fragPath)
+	{
+		TRACE_ZONE("ShaderProgram::Create");
+
+		if (createdPrograms.contains(programName))
+		{
+			Logger::Print(
+				"Shader program '" + programName + "' already exists!",
+				"SHADER_PROGRAM",
+				LogType::LOG_ERROR,
+				2);
+
+			return createdPrograms[programName].get();
+		}
+
+		string vertSource{};
+		string fragSource{};
+		if (!ReadSource(vertPath, vertSource)
+			|| !ReadSource(fragPath, fragSource))
+		{
+			return nullptr;
+		}
+
+		uint64_t key = HashString(driver);
+		key = HashString(vertSource, key);
+		key = HashString(fragSource, key);
+
+		unique_ptr<ShaderProgram> program = make_unique<ShaderProgram>();
+		program->name = programName;
+		program->programID = glCreateProgram();
+
+		if (cache.IsEnabled()
+			&& RestoreBinary(cache, programName, key, program->programID))
+		{
+			program->isCached = true;
+
+			Logger::Print(
+				"Restored shader program '" + programName + "' from the program cache!",
+				"SHADER_PROGRAM",
+				LogType::LOG_SUCCESS);
+
+			createdPrograms[programName] = move(program);
+			return createdPrograms[programName].get();
+		}
+
+		//a rejected binary leaves the program unlinked, a fresh one avoids any leftover state
+		glDeleteProgram(program->programID);
+		program->programID = glCreateProgram();
+
+		if (cache.IsEnabled())
+		{
+			glProgramParameteri(program->programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+		}
+
+		GLuint vertShader = CompileStage(GL_VERTEX_SHADER, vertSource, vertPath);
+		GLuint fragShader = CompileStage(GL_FRAGMENT_SHADER, fragSource, fragPath);
+
+		if (vertShader == 0
+			|| fragShader == 0)
+		{
+			if (vertShader != 0) glDeleteShader(vertShader);
+			if (fragShader != 0) glDeleteShader(fragShader);
+
+			return nullptr;
+		}
+
+		glAttachShader(program->programID, vertShader);
+		glAttachShader(program->programID, fragShader);
+		glLinkProgram(program->programID);
+
+		//the linked program keeps its own copy of the code
+		glDetachShader(program->programID, vertShader);
+		glDetachShader(program->programID, fragShader);
+		glDeleteShader(vertShader);
+		glDeleteShader(fragShader);
+
+		if (!IsLinked(program->programID))
+		{
+			GLint logLength = 0;
+			glGetProgramiv(program->programID, GL_INFO_LOG_LENGTH, &logLength);
+
+			string log(static_cast<size_t>(logLength > 1 ? logLength : 1), '\0');
+			glGetProgramInfoLog(program->programID, logLength, nullptr, log.data());
+
+			Logger::Print(
+				"Failed to link shader program '" + programName + "'! Reason: " + log,
+				"SHADER_PROGRAM",
+				LogType::LOG_ERROR,
+				2);
+
+			return nullptr;
+		}
+
+		if (cache.IsEnabled())
+		{
+			GLint binaryLength = 0;
+			glGetProgramiv(program->programID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+
+			vector<uint8_t> binary(static_cast<size_t>(binaryLength));
+			GLenum binaryFormat{};
+			GLsizei writtenLength = 0;
+			if (binaryLength > 0)
+			{
+				glGetProgramBinary(
+					program->programID,
+					binaryLength,
+					&writtenLength,
+					&binaryFormat,
+					binary.data());
+			}
+
+			ProgramHeader header{};
+			header.magic = CACHE_MAGIC;
+			header.version = CACHE_VERSION;
+			header.key = key;
+			header.binaryFormat = binaryFormat;
+			header.binaryLength = static_cast<uint32_t>(writtenLength);
+
+			string error{};
+			if (writtenLength > 0
+				&& !cache.Write(
+					programName,
+					key,
+					{
+						{ &header, sizeof(header) },
+						{ binary.data(), static_cast<size_t>(writtenLength) }
+					},
+					error))
+			{
+				Logger::Print(
+					"Failed to cache shader program '" + programName + "' because " + error + "!",
+					"SHADER_PROGRAM",
+					LogType::LOG_WARNING);
+			}
+		}
+
+		Logger::Print(
+			"Compiled and linked shader program '" + programName + "'!",
+			"SHADER_PROGRAM",
+			LogType::LOG_SUCCESS);
+
+		createdPrograms[programName] = move(program);
+		return createdPrograms[programName].get();
+	}
+
+	ShaderProgram::~ShaderProgram()
+	{
+		if (programID != 0) glDeleteProgram(programID);
+	}
+}
+
+bool ReadSource(
+	const string& sourcePath,
+	string& source)
+{
+	ifstream file(sourcePath);
+	if (!file.is_open())
+	{
+		Logger::Print(
+			"Failed to open shader source '" + sourcePath + "'!",
+			"SHADER_PROGRAM",
+			LogType::LOG_ERROR,
+			2);
+
+		return false;
+	}
+
+	ostringstream stream{};
+	stream << file.rdbuf();
+	source = stream.str();
+
+	return true;
+}
+
+GLuint CompileStage(
+	GLenum type,
+	const string& source,
+	const string& sourcePath)
+{
+	GLuint shader = glCreateShader(type);
+
+	const char* text = source.c_str();
+	glShaderSource(shader, 1, &text, nullptr);
+	glCompileShader(shader);
+
+	GLint isCompiled = 0;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
+	if (isCompiled == GL_TRUE) return shader;
+
+	GLint logLength = 0;
+	glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &logLength);
+
+	string log(static_cast<size_t>(logLength > 1 ? logLength : 1), '\0');
+	glGetShaderInfoLog(shader, logLength, nullptr, log.data());
+
+	Logger::Print(
+		"Failed to compile shader '" + sourcePath + "'! Reason: " + log,
+		"SHADER_PROGRAM",
+		LogType::LOG_ERROR,
+		2);
+
+	glDeleteShader(shader);
+	return 0;
+}
+
+bool RestoreBinary(
+	DiskCache& cache,
+	const string& programName,
+	uint64_t key,
+	GLuint program)
+{
+	string error{};
+	unique_ptr<MappedFile> blob = cache.Map(programName, key, error);
+	if (!error.empty())
+	{
+		Logger::Print(
+			"Failed to read cached shader program '" + programName + "' because " + error + "!",
+			"SHADER_PROGRAM",
+			LogType::LOG_WARNING);
+	}
+
+	if (blob == nullptr
+		|| blob->GetSize() < sizeof(ProgramHeader))
+	{
+		return false;
+	}
+
+	ProgramHeader header{};
+	memcpy(&header, blob->GetData(), sizeof(header));
+
+	if (header.magic != CACHE_MAGIC
+		|| header.version != CACHE_VERSION
+		|| header.key != key
+		|| header.binaryLength == 0
+		|| blob->GetSize() - sizeof(ProgramHeader) != header.binaryLength)
+	{
+		return false;
+	}
+
+	glProgramBinary(
+		program,
+		header.binaryFormat,
+		blob->GetData() + sizeof(ProgramHeader),
+		static_cast<GLsizei>(header.binaryLength));
+
+	//drivers reject binaries of other versions or hardware by failing the link
+	return IsLinked(program);
+}
+
+bool IsLinked(GLuint program)
+{
+	GLint isLinked = 0;
+	glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+	return isLinked == GL_TRUE;
+}
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 
+//decoding happens in TextureLoader and TextureArray, this only hosts the implementation
 #define STB_IMAGE_IMPLEMENTATION
 #include "../stb_image/stb_image.h"
 
@@ -20,6 +21,7 @@
 
 #include "graphics/texture.hpp"
 #include "graphics/render.hpp"
+#include "graphics/textureloader.hpp"
 
 //kalawindow
 using KalaWindow::Core::KalaWindowCore;
@@ -29,6 +31,7 @@ using KalaWindow::Graphics::Window;
 
 using CircuitGame::Graphics::Texture;
 using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::TextureLoader;
 
 using std::make_unique;
 using std::move;
@@ -70,73 +73,16 @@ namespace CircuitGame::Graphics
 			return Render::createdTextures[textureName].get();
 		}
 
-		Logger::Print(
-			"Loading texture '" + textureName + "'.",
-			"TEXTURE",
-			LogType::LOG_INFO);
-
-		unsigned int newTextureID{};
-		glGenTextures(1, &newTextureID);
-		glBindTexture(GL_TEXTURE_2D, newTextureID);
-
-		glTexParameteri(
-			GL_TEXTURE_2D,
-			GL_TEXTURE_WRAP_S,
-			GL_REPEAT);
-		glTexParameteri(
-			GL_TEXTURE_2D,
-			GL_TEXTURE_WRAP_T,
-			GL_REPEAT);
-
-		glTexParameteri(
-			GL_TEXTURE_2D,
-			GL_TEXTURE_MIN_FILTER,
-			GL_LINEAR);
-		glTexParameteri(
-			GL_TEXTURE_2D,
-			GL_TEXTURE_MAG_FILTER,
-			GL_LINEAR);
-
-		int width{};
-		int height{};
-		int nrChannels{};
-		stbi_set_flip_vertically_on_load(true);
-
-		unsigned char* data = stbi_load(
-			(texturePath).c_str(),
-			&width,
-			&height,
-			&nrChannels,
-			0);
-
-		if (!data)
-		{
-			KalaWindowCore::ForceClose(
-				"Texture error",
-				"Failed to load texture '" + texturePath + "'!");
-
-			return nullptr;
-		}
-
-		glTexImage2D(
-			GL_TEXTURE_2D,
-			0,
-			GL_RGBA,
-			width,
-			height,
-			0,
-			GL_RGBA,
-			GL_UNSIGNED_BYTE,
-			data);
-
 		unique_ptr<Texture> tex = make_unique<Texture>();
-		tex->textureID = newTextureID;
+		tex->textureID = TextureLoader::GetPlaceholder(GL_TEXTURE_2D);
 		tex->texturePath = texturePath;
 
+		TextureLoader::QueueTexture(textureName, tex.get());
+
 		Logger::Print(
-			"Loaded texture '" + texturePath + "'!",
+			"Queued texture '" + textureName + "' for loading.",
 			"TEXTURE",
-			LogType::LOG_SUCCESS);
+			LogType::LOG_INFO);
 
 		Render::createdTextures[textureName] = move(tex);
 		Render::runtimeTextures.push_back(Render::createdTextures[textureName].get());
@@ -0,0 +1,306 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../stb_image/stb_image.h"
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/texturearray.hpp"
+#include "graphics/atlaspacker.hpp"
+#include "graphics/texture.hpp"
+#include "graphics/textureloader.hpp"
+#include "graphics/render.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::TextureArray;
+using CircuitGame::Graphics::SpriteSource;
+using CircuitGame::Graphics::DecodedImage;
+using CircuitGame::Graphics::AtlasPacker;
+using CircuitGame::Graphics::AtlasRect;
+using CircuitGame::Graphics::Texture;
+using CircuitGame::Graphics::TextureLoader;
+using CircuitGame::Graphics::Render;
+using CircuitGame::Graphics::GLState;
+
+using std::clamp;
+using std::max;
+using std::min;
+using std::memcpy;
+using std::sqrt;
+using std::filesystem::exists;
+using std::make_unique;
+using std::move;
+using std::unique_ptr;
+using std::string;
+using std::to_string;
+using std::vector;
+
+struct DecodedSprite
+{
+	unsigned char* pixels{}; //RGBA, owned by stb_image
+	uint32_t width{};
+	uint32_t height{};
+};
+
+static uint32_t NextPowerOfTwo(uint32_t value);
+
+//Copies sprite into layer at rect and repeats its outermost pixels across the padding around it
+static void BlitPadded(
+	const DecodedSprite& sprite,
+	const AtlasRect& rect,
+	uint32_t padding,
+	uint32_t layerSize,
+	unsigned char* layer);
+
+namespace CircuitGame::Graphics
+{
+	bool TextureArray::Create(
+		const string& arrayName,
+		const vector<SpriteSource>& sprites,
+		uint32_t maxLayerSize,
+		uint32_t padding)
+	{
+		if (sprites.empty()) return true;
+
+		for (const auto& source : sprites)
+		{
+			if (!exists(source.texturePath))
+			{
+				Logger::Print(
+					"Cannot create texture array '" + arrayName + "' because sprite '"
+					+ source.texturePath + "' does not exist!",
+					"TEXTURE_ARRAY",
+					LogType::LOG_ERROR,
+					2);
+
+				return false;
+			}
+		}
+
+		vector<Texture*> spriteTextures{};
+		for (const auto& source : sprites)
+		{
+			unique_ptr<Texture> tex = make_unique<Texture>();
+			tex->textureID = TextureLoader::GetPlaceholder(GL_TEXTURE_2D_ARRAY);
+			tex->texturePath = source.texturePath;
+			tex->target = GL_TEXTURE_2D_ARRAY;
+
+			spriteTextures.push_back(tex.get());
+
+			Render::createdTextures[source.textureName] = move(tex);
+			Render::runtimeTextures.push_back(spriteTextures.back());
+		}
+
+		TextureLoader::QueueArray(
+			arrayName,
+			spriteTextures,
+			sprites,
+			maxLayerSize,
+			padding);
+
+		return true;
+	}
+
+	bool TextureArray::Compose(
+		const vector<SpriteSource>& sprites,
+		uint32_t maxLayerSize,
+		uint32_t padding,
+		DecodedImage& out,
+		string& error)
+	{
+		vector<DecodedSprite> decoded{};
+		auto freeDecoded = [&decoded]()
+			{
+				for (const auto& sprite : decoded) stbi_image_free(sprite.pixels);
+			};
+
+		//the flip flag is per thread, so workers decoding other images are not affected
+		stbi_set_flip_vertically_on_load_thread(true);
+
+		uint32_t largestSide = 0;
+		uint64_t paddedArea = 0;
+
+		for (const auto& source : sprites)
+		{
+			int width{};
+			int height{};
+			int channels{};
+
+			unsigned char* pixels = stbi_load(
+				source.texturePath.c_str(),
+				&width,
+				&height,
+				&channels,
+				4);
+
+			if (pixels == nullptr)
+			{
+				error = "sprite '" + source.texturePath + "' could not be decoded";
+
+				freeDecoded();
+				return false;
+			}
+
+			decoded.push_back({ pixels, static_cast<uint32_t>(width), static_cast<uint32_t>(height) });
+
+			uint32_t paddedWidth = static_cast<uint32_t>(width) + padding * 2;
+			uint32_t paddedHeight = static_cast<uint32_t>(height) + padding * 2;
+			largestSide = max(largestSide, max(paddedWidth, paddedHeight));
+			paddedArea += static_cast<uint64_t>(paddedWidth) * paddedHeight;
+		}
+
+		//just large enough for the biggest sprite and, ideally, for everything on one layer
+		uint32_t layerSize = NextPowerOfTwo(max(
+			largestSide,
+			static_cast<uint32_t>(sqrt(static_cast<double>(paddedArea)))));
+		layerSize = min(layerSize, maxLayerSize);
+
+		AtlasPacker packer(layerSize, padding);
+		for (const auto& sprite : decoded) packer.Add(sprite.width, sprite.height);
+
+		if (!packer.Pack())
+		{
+			error = "a sprite does not fit a '" + to_string(layerSize) + "' pixel layer";
+
+			freeDecoded();
+			return false;
+		}
+
+		out.width = layerSize;
+		out.height = layerSize;
+		out.layerCount = packer.GetLayerCount();
+		out.levelCount = 1;
+
+		size_t layerBytes = out.GetLayerSize(0);
+		out.storage.assign(layerBytes * out.layerCount, 0);
+		out.pixels = out.storage.data();
+		out.regions.clear();
+
+		float size = static_cast<float>(layerSize);
+		for (size_t i = 0; i < decoded.size(); i++)
+		{
+			const AtlasRect& rect = packer.GetRects()[i];
+
+			BlitPadded(
+				decoded[i],
+				rect,
+				padding,
+				layerSize,
+				out.storage.data() + layerBytes * rect.layer);
+
+			TextureRegion region{};
+			region.uvRect = vec4(
+				static_cast<float>(rect.x) / size,
+				static_cast<float>(rect.y) / size,
+				static_cast<float>(rect.width) / size,
+				static_cast<float>(rect.height) / size);
+			region.layer = static_cast<float>(rect.layer);
+			out.regions.push_back(region);
+		}
+
+		freeDecoded();
+
+		return true;
+	}
+
+	uint32_t TextureArray::GetLevelCount(uint32_t padding)
+	{
+		uint32_t levelCount = 1;
+		for (uint32_t band = padding; band > 1; band /= 2) levelCount++;
+		return levelCount;
+	}
+
+	GLuint TextureArray::Allocate(const DecodedImage& image)
+	{
+		GLuint arrayID{};
+		glGenTextures(1, &arrayID);
+		GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, arrayID);
+
+		for (uint32_t level = 0; level < image.levelCount; level++)
+		{
+			glTexImage3D(
+				GL_TEXTURE_2D_ARRAY,
+				static_cast<GLint>(level),
+				GL_RGBA8,
+				static_cast<GLsizei>(image.GetLevelWidth(level)),
+				static_cast<GLsizei>(image.GetLevelHeight(level)),
+				static_cast<GLsizei>(image.layerCount),
+				0,
+				GL_RGBA,
+				GL_UNSIGNED_BYTE,
+				nullptr);
+		}
+
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.levelCount - 1));
+
+		createdArrays.push_back(arrayID);
+
+		return arrayID;
+	}
+
+	void TextureArray::Shutdown()
+	{
+		for (GLuint arrayID : createdArrays)
+		{
+			glDeleteTextures(1, &arrayID);
+			GLState::OnTextureDeleted(arrayID);
+		}
+		createdArrays.clear();
+	}
+}
+
+uint32_t NextPowerOfTwo(uint32_t value)
+{
+	uint32_t result = 1;
+	while (result < value) result *= 2;
+	return result;
+}
+
+void BlitPadded(
+	const DecodedSprite& sprite,
+	const AtlasRect& rect,
+	uint32_t padding,
+	uint32_t layerSize,
+	unsigned char* layer)
+{
+	int64_t width = sprite.width;
+	int64_t height = sprite.height;
+	int64_t pad = padding;
+
+	for (int64_t y = -pad; y < height + pad; y++)
+	{
+		int64_t sourceY = clamp<int64_t>(y, 0, height - 1);
+		unsigned char* row = layer + ((rect.y + y) * layerSize + rect.x) * 4;
+		const unsigned char* sourceRow = sprite.pixels + sourceY * width * 4;
+
+		//the sprite itself in one copy, only the padding columns are clamped pixel by pixel
+		memcpy(row, sourceRow, static_cast<size_t>(width) * 4);
+
+		for (int64_t x = 1; x <= pad; x++)
+		{
+			memcpy(row - x * 4, sourceRow, 4);
+			memcpy(row + (width - 1 + x) * 4, sourceRow + (width - 1) * 4, 4);
+		}
+	}
+}
\ No newline at end of file
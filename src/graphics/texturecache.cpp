@@ -0,0 +1,296 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "graphics/texturecache.hpp"
+#include "core/mappedfile.hpp"
+#include "core/diskcache.hpp"
+#include "core/hash.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::TextureCache;
+using CircuitGame::Graphics::DecodedImage;
+using CircuitGame::Graphics::TextureRegion;
+using CircuitGame::Core::MappedFile;
+using CircuitGame::Core::BlobPart;
+using CircuitGame::Core::HashBytes;
+using CircuitGame::Core::HashString;
+
+using std::min;
+using std::memcpy;
+using std::move;
+using std::string;
+using std::to_string;
+using std::vector;
+
+static constexpr uint32_t CACHE_MAGIC = 0x58544743; //"CGTX"
+static constexpr uint32_t CACHE_VERSION = 1;
+static constexpr const char* CACHE_EXTENSION = ".cgtex";
+
+//Fixed-size start of every blob, followed by the regions and then the pixels
+struct CacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t key;
+	uint32_t width;
+	uint32_t height;
+	uint32_t layerCount;
+	uint32_t levelCount;
+	uint32_t regionCount;
+	uint32_t pixelOffset; //from the start of the file, 16 byte aligned
+};
+
+//Uv rectangle and layer of a region, written as plain floats
+static constexpr size_t REGION_SIZE = 5 * sizeof(float);
+
+namespace CircuitGame::Graphics
+{
+	const uint8_t* DecodedImage::GetLayer(
+		uint32_t level,
+		uint32_t layer) const
+	{
+		size_t offset = 0;
+		for (uint32_t i = 0; i < level; i++)
+		{
+			offset += GetLayerSize(i) * layerCount;
+		}
+		return pixels + offset + GetLayerSize(level) * layer;
+	}
+
+	size_t DecodedImage::GetTotalSize() const
+	{
+		size_t size = 0;
+		for (uint32_t level = 0; level < levelCount; level++)
+		{
+			size += GetLayerSize(level) * layerCount;
+		}
+		return size;
+	}
+
+	bool TextureCache::Initialize(const string& directory)
+	{
+		string error{};
+		if (!cache.Initialize(directory, CACHE_EXTENSION, error))
+		{
+			Logger::Print(
+				"Failed to create texture cache directory '" + directory + "', textures are decoded on every launch! Reason: "
+				+ error,
+				"TEXTURE_CACHE",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool TextureCache::MakeKey(
+		const vector<string>& sourcePaths,
+		const string& settings,
+		uint64_t& key)
+	{
+		uint64_t hash = HashBytes(&CACHE_VERSION, sizeof(CACHE_VERSION));
+		hash = HashString(settings, hash);
+
+		for (const auto& sourcePath : sourcePaths)
+		{
+			string error{};
+			unique_ptr<MappedFile> source = MappedFile::Open(sourcePath, error);
+			if (source == nullptr) return false;
+
+			uint64_t size = source->GetSize();
+			hash = HashBytes(&size, sizeof(size), hash);
+			hash = HashBytes(source->GetData(), source->GetSize(), hash);
+		}
+
+		key = hash;
+		return true;
+	}
+
+	bool TextureCache::Load(
+		const string& name,
+		uint64_t key,
+		DecodedImage& image,
+		string& error)
+	{
+		unique_ptr<MappedFile> blob = cache.Map(name, key, error);
+		if (blob == nullptr
+			|| blob->GetSize() < sizeof(CacheHeader))
+		{
+			return false;
+		}
+
+		CacheHeader header{};
+		memcpy(&header, blob->GetData(), sizeof(header));
+
+		if (header.magic != CACHE_MAGIC
+			|| header.version != CACHE_VERSION
+			|| header.key != key
+			|| header.width == 0
+			|| header.height == 0
+			|| header.layerCount == 0
+			|| header.levelCount == 0
+			|| header.levelCount > 32
+			|| header.pixelOffset < sizeof(CacheHeader) + header.regionCount * REGION_SIZE)
+		{
+			return false;
+		}
+
+		DecodedImage loaded{};
+		loaded.width = header.width;
+		loaded.height = header.height;
+		loaded.layerCount = header.layerCount;
+		loaded.levelCount = header.levelCount;
+
+		//a truncated write must never be read past the end of the mapping
+		if (blob->GetSize() < header.pixelOffset
+			|| blob->GetSize() - header.pixelOffset != loaded.GetTotalSize())
+		{
+			return false;
+		}
+
+		const uint8_t* regionData = blob->GetData() + sizeof(CacheHeader);
+		for (uint32_t i = 0; i < header.regionCount; i++)
+		{
+			float values[5]{};
+			memcpy(values, regionData + i * REGION_SIZE, REGION_SIZE);
+
+			TextureRegion region{};
+			region.uvRect = vec4(values[0], values[1], values[2], values[3]);
+			region.layer = values[4];
+			loaded.regions.push_back(region);
+		}
+
+		loaded.pixels = blob->GetData() + header.pixelOffset;
+		loaded.file = move(blob);
+
+		image = move(loaded);
+		return true;
+	}
+
+	bool TextureCache::Store(
+		const string& name,
+		uint64_t key,
+		const DecodedImage& image,
+		string& error)
+	{
+		if (!cache.IsEnabled()) return true;
+
+		CacheHeader header{};
+		header.magic = CACHE_MAGIC;
+		header.version = CACHE_VERSION;
+		header.key = key;
+		header.width = image.width;
+		header.height = image.height;
+		header.layerCount = image.layerCount;
+		header.levelCount = image.levelCount;
+		header.regionCount = static_cast<uint32_t>(image.regions.size());
+
+		size_t regionEnd = sizeof(CacheHeader) + image.regions.size() * REGION_SIZE;
+		header.pixelOffset = static_cast<uint32_t>((regionEnd + 15) / 16 * 16);
+
+		vector<float> regionValues{};
+		for (const auto& region : image.regions)
+		{
+			regionValues.insert(
+				regionValues.end(),
+				{ region.uvRect.x, region.uvRect.y, region.uvRect.z, region.uvRect.w, region.layer });
+		}
+
+		const uint8_t zeroes[16]{};
+
+		return cache.Write(
+			name,
+			key,
+			{
+				{ &header, sizeof(header) },
+				{ regionValues.data(), regionValues.size() * sizeof(float) },
+				{ zeroes, header.pixelOffset - regionEnd },
+				{ image.pixels, image.GetTotalSize() }
+			},
+			error);
+	}
+
+	void TextureCache::BuildMipmaps(
+		DecodedImage& image,
+		uint32_t levelCount)
+	{
+		levelCount = min(levelCount, GetFullLevelCount(image.width, image.height));
+		if (levelCount <= 1) return;
+
+		size_t baseSize = image.GetLayerSize(0) * image.layerCount;
+		if (image.storage.size() < baseSize) return;
+
+		image.storage.resize(baseSize);
+		image.levelCount = levelCount;
+		image.storage.resize(image.GetTotalSize());
+		image.pixels = image.storage.data();
+
+		for (uint32_t level = 1; level < levelCount; level++)
+		{
+			uint32_t sourceWidth = image.GetLevelWidth(level - 1);
+			uint32_t sourceHeight = image.GetLevelHeight(level - 1);
+			uint32_t width = image.GetLevelWidth(level);
+			uint32_t height = image.GetLevelHeight(level);
+
+			for (uint32_t layer = 0; layer < image.layerCount; layer++)
+			{
+				const uint8_t* source = image.GetLayer(level - 1, layer);
+				uint8_t* destination = const_cast<uint8_t*>(image.GetLayer(level, layer));
+
+				for (uint32_t y = 0; y < height; y++)
+				{
+					//odd sizes repeat their last row or column
+					uint32_t y0 = min(y * 2, sourceHeight - 1);
+					uint32_t y1 = min(y * 2 + 1, sourceHeight - 1);
+
+					for (uint32_t x = 0; x < width; x++)
+					{
+						uint32_t x0 = min(x * 2, sourceWidth - 1);
+						uint32_t x1 = min(x * 2 + 1, sourceWidth - 1);
+
+						const uint8_t* p00 = source + (static_cast<size_t>(y0) * sourceWidth + x0) * 4;
+						const uint8_t* p01 = source + (static_cast<size_t>(y0) * sourceWidth + x1) * 4;
+						const uint8_t* p10 = source + (static_cast<size_t>(y1) * sourceWidth + x0) * 4;
+						const uint8_t* p11 = source + (static_cast<size_t>(y1) * sourceWidth + x1) * 4;
+
+						uint8_t* out = destination + (static_cast<size_t>(y) * width + x) * 4;
+						for (uint32_t c = 0; c < 4; c++)
+						{
+							out[c] = static_cast<uint8_t>((p00[c] + p01[c] + p10[c] + p11[c] + 2) / 4);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	uint32_t TextureCache::GetFullLevelCount(
+		uint32_t width,
+		uint32_t height)
+	{
+		uint32_t levelCount = 1;
+		while ((width >> levelCount) > 0
+			|| (height >> levelCount) > 0)
+		{
+			levelCount++;
+		}
+		return levelCount;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,498 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../stb_image/stb_image.h"
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/textureloader.hpp"
+#include "graphics/texture.hpp"
+#include "graphics/texturearray.hpp"
+#include "graphics/texturecache.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+#include "graphics/redrawtracker.hpp"
+#include "core/threadpool.hpp"
+#include "core/trace.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::TextureLoader;
+using CircuitGame::Graphics::TextureLoadJob;
+using CircuitGame::Graphics::Texture;
+using CircuitGame::Graphics::TextureArray;
+using CircuitGame::Graphics::SpriteSource;
+using CircuitGame::Graphics::DecodedImage;
+using CircuitGame::Graphics::TextureCache;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::RedrawTracker;
+using CircuitGame::Graphics::RedrawReason;
+using CircuitGame::Graphics::TEXTURE_UPLOAD_BUDGET;
+using CircuitGame::Core::ThreadPool;
+
+using std::memcpy;
+using std::deque;
+using std::lock_guard;
+using std::mutex;
+using std::make_shared;
+using std::shared_ptr;
+using std::move;
+using std::string;
+using std::to_string;
+using std::vector;
+
+struct CircuitGame::Graphics::TextureLoadJob
+{
+	string name{};
+	vector<Texture*> textures{}; //a single texture unless isArray
+
+	bool isArray = false;
+	vector<SpriteSource> sprites{};
+	uint32_t maxLayerSize{};
+	uint32_t padding{};
+
+	//filled by the worker
+	bool isDecoded = false;
+	bool isCached = false; //mapped from the texture cache instead of decoded
+	string error{};
+	string cacheError{};
+	DecodedImage image{};
+
+	//upload progress on the render thread
+	GLuint textureID{};
+	uint32_t nextLayer{};
+	uint32_t nextLevel{};
+	uint32_t nextRow{};
+};
+
+static ThreadPool pool{};
+
+static mutex finishedMutex{};
+static deque<shared_ptr<TextureLoadJob>> finishedJobs{}; //guarded by finishedMutex
+
+static deque<shared_ptr<TextureLoadJob>> uploadingJobs{}; //render thread only
+static size_t pendingCount{};
+
+static GLuint placeholder2D{};
+static GLuint placeholderArray{};
+static GLuint stagingBuffer{};
+
+//Runs on a worker, maps the job from the texture cache or decodes, mipmaps and caches it,
+//touches no GL state
+static void Decode(TextureLoadJob& job);
+
+//Copies pixels into the staging buffer and returns what the next glTex*Image call should read,
+//an offset into the bound staging buffer, or pixels itself if the buffer could not be mapped
+static const void* Stage(
+	const unsigned char* pixels,
+	size_t size);
+
+static void Submit(const shared_ptr<TextureLoadJob>& job);
+
+namespace CircuitGame::Graphics
+{
+	bool TextureLoader::Initialize()
+	{
+		const unsigned char white[4] = { 255, 255, 255, 255 };
+
+		glGenTextures(1, &placeholder2D);
+		GLState::BindTexture(0, GL_TEXTURE_2D, placeholder2D);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+
+		glGenTextures(1, &placeholderArray);
+		GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, placeholderArray);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+		glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, 1, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, white);
+
+		glGenBuffers(1, &stagingBuffer);
+
+		pool.Start();
+
+		Logger::Print(
+			"Initialized texture loader with '" + to_string(pool.GetThreadCount()) + "' decode threads!",
+			"TEXTURE_LOADER",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+
+	void TextureLoader::QueueTexture(
+		const string& textureName,
+		Texture* texture)
+	{
+		shared_ptr<TextureLoadJob> job = make_shared<TextureLoadJob>();
+		job->name = textureName;
+		job->textures.push_back(texture);
+
+		Submit(job);
+	}
+
+	void TextureLoader::QueueArray(
+		const string& arrayName,
+		const vector<Texture*>& textures,
+		const vector<SpriteSource>& sprites,
+		uint32_t maxLayerSize,
+		uint32_t padding)
+	{
+		shared_ptr<TextureLoadJob> job = make_shared<TextureLoadJob>();
+		job->name = arrayName;
+		job->textures = textures;
+		job->isArray = true;
+		job->sprites = sprites;
+		job->maxLayerSize = maxLayerSize;
+		job->padding = padding;
+
+		Submit(job);
+	}
+
+	GLuint TextureLoader::GetPlaceholder(GLenum target)
+	{
+		return target == GL_TEXTURE_2D_ARRAY
+			? placeholderArray
+			: placeholder2D;
+	}
+
+	void TextureLoader::Update()
+	{
+		if (pendingCount == 0) return;
+
+		TRACE_ZONE("TextureLoader::Update");
+
+		{
+			lock_guard<mutex> lock(finishedMutex);
+			while (!finishedJobs.empty())
+			{
+				uploadingJobs.push_back(move(finishedJobs.front()));
+				finishedJobs.pop_front();
+			}
+		}
+
+		size_t uploaded = 0;
+		while (!uploadingJobs.empty()
+			&& uploaded < TEXTURE_UPLOAD_BUDGET)
+		{
+			TextureLoadJob& job = *uploadingJobs.front();
+
+			if (!job.isDecoded)
+			{
+				//worker errors are logged here, the logger is not thread safe
+				Logger::Print(
+					"Failed to load texture '" + job.name + "' because " + job.error + ", keeping the placeholder!",
+					"TEXTURE_LOADER",
+					LogType::LOG_ERROR,
+					2);
+
+				uploadingJobs.pop_front();
+				pendingCount--;
+				continue;
+			}
+
+			if (!job.cacheError.empty())
+			{
+				Logger::Print(
+					"Failed to use the texture cache for '" + job.name + "' because " + job.cacheError + "!",
+					"TEXTURE_CACHE",
+					LogType::LOG_WARNING);
+
+				job.cacheError.clear();
+			}
+
+			bool isDone = false;
+			uploaded += UploadStep(job, TEXTURE_UPLOAD_BUDGET - uploaded, isDone);
+
+			if (isDone)
+			{
+				uploadingJobs.pop_front();
+				pendingCount--;
+
+				RedrawTracker::Request(RedrawReason::scene);
+			}
+		}
+	}
+
+	size_t TextureLoader::GetPendingCount()
+	{
+		return pendingCount;
+	}
+
+	void TextureLoader::Shutdown()
+	{
+		//running decodes finish first, so nothing writes finishedJobs after this
+		pool.Stop();
+
+		{
+			lock_guard<mutex> lock(finishedMutex);
+			finishedJobs.clear();
+		}
+		uploadingJobs.clear();
+		pendingCount = 0;
+
+		glDeleteBuffers(1, &stagingBuffer);
+		stagingBuffer = 0;
+
+		for (GLuint* placeholder : { &placeholder2D, &placeholderArray })
+		{
+			glDeleteTextures(1, placeholder);
+			GLState::OnTextureDeleted(*placeholder);
+			*placeholder = 0;
+		}
+	}
+
+	size_t TextureLoader::UploadStep(
+		TextureLoadJob& job,
+		size_t budget,
+		bool& isDone)
+	{
+		const DecodedImage& image = job.image;
+		size_t uploaded = 0;
+
+		if (!job.isArray)
+		{
+			//storage for every level is allocated before the staging buffer is bound,
+			//a null pointer would read from it otherwise
+			if (job.textureID == 0)
+			{
+				glGenTextures(1, &job.textureID);
+				GLState::BindTexture(0, GL_TEXTURE_2D, job.textureID);
+
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(image.levelCount - 1));
+
+				for (uint32_t level = 0; level < image.levelCount; level++)
+				{
+					glTexImage2D(
+						GL_TEXTURE_2D,
+						static_cast<GLint>(level),
+						GL_RGBA,
+						static_cast<GLsizei>(image.GetLevelWidth(level)),
+						static_cast<GLsizei>(image.GetLevelHeight(level)),
+						0,
+						GL_RGBA,
+						GL_UNSIGNED_BYTE,
+						nullptr);
+				}
+			}
+			else GLState::BindTexture(0, GL_TEXTURE_2D, job.textureID);
+
+			//every level comes precomputed, nothing is generated on the GPU.
+			//Large levels are split into row ranges, so no single step goes past the frame budget.
+			uint32_t width = image.GetLevelWidth(job.nextLevel);
+			uint32_t height = image.GetLevelHeight(job.nextLevel);
+			size_t rowSize = static_cast<size_t>(width) * 4;
+
+			uint32_t rowCount = height - job.nextRow;
+			if (budget / rowSize < rowCount) rowCount = static_cast<uint32_t>(budget / rowSize);
+			if (rowCount == 0) rowCount = 1;
+
+			size_t size = rowSize * rowCount;
+			glTexSubImage2D(
+				GL_TEXTURE_2D,
+				static_cast<GLint>(job.nextLevel),
+				0,
+				static_cast<GLint>(job.nextRow),
+				static_cast<GLsizei>(width),
+				static_cast<GLsizei>(rowCount),
+				GL_RGBA,
+				GL_UNSIGNED_BYTE,
+				Stage(image.GetLayer(job.nextLevel, 0) + rowSize * job.nextRow, size));
+			glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+			uploaded += size;
+
+			job.nextRow += rowCount;
+			if (job.nextRow == height)
+			{
+				job.nextRow = 0;
+				job.nextLevel++;
+			}
+			if (job.nextLevel < image.levelCount) return uploaded;
+
+			job.textures.front()->textureID = job.textureID;
+		}
+		else
+		{
+			//allocated before the staging buffer is bound, a null pointer would read from it otherwise
+			if (job.textureID == 0) job.textureID = TextureArray::Allocate(image);
+
+			GLState::BindTexture(0, GL_TEXTURE_2D_ARRAY, job.textureID);
+
+			for (uint32_t level = 0; level < image.levelCount; level++)
+			{
+				size_t size = image.GetLayerSize(level);
+				glTexSubImage3D(
+					GL_TEXTURE_2D_ARRAY,
+					static_cast<GLint>(level),
+					0,
+					0,
+					static_cast<GLint>(job.nextLayer),
+					static_cast<GLsizei>(image.GetLevelWidth(level)),
+					static_cast<GLsizei>(image.GetLevelHeight(level)),
+					1,
+					GL_RGBA,
+					GL_UNSIGNED_BYTE,
+					Stage(image.GetLayer(level, job.nextLayer), size));
+				glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+				uploaded += size;
+			}
+
+			job.nextLayer++;
+			if (job.nextLayer < image.layerCount) return uploaded;
+
+			for (size_t i = 0; i < job.textures.size(); i++)
+			{
+				Texture* texture = job.textures[i];
+				texture->textureID = job.textureID;
+				texture->region = image.regions[i];
+			}
+		}
+
+		Logger::Print(
+			"Loaded texture '" + job.name + "' with '" + to_string(image.layerCount) + "' layers and '"
+			+ to_string(image.levelCount) + "' mip levels" + (job.isCached ? " from the cache!" : "!"),
+			"TEXTURE",
+			LogType::LOG_SUCCESS);
+
+		//unmaps the cache file or frees the decoded pixels
+		job.image = {};
+		isDone = true;
+		return uploaded;
+	}
+}
+
+void Decode(TextureLoadJob& job)
+{
+	TRACE_ZONE("TextureLoader::Decode");
+
+	vector<string> sourcePaths{};
+	string settings{};
+	if (job.isArray)
+	{
+		for (const auto& sprite : job.sprites) sourcePaths.push_back(sprite.texturePath);
+		settings = "array " + to_string(job.maxLayerSize) + " " + to_string(job.padding);
+	}
+	else
+	{
+		sourcePaths.push_back(job.textures.front()->GetTexturePath());
+		settings = "2d";
+	}
+
+	uint64_t key{};
+	bool hasKey = TextureCache::MakeKey(sourcePaths, settings, key);
+
+	if (hasKey
+		&& TextureCache::Load(job.name, key, job.image, job.cacheError))
+	{
+		job.isCached = true;
+		job.isDecoded = true;
+		return;
+	}
+
+	if (job.isArray)
+	{
+		if (!TextureArray::Compose(
+			job.sprites,
+			job.maxLayerSize,
+			job.padding,
+			job.image,
+			job.error))
+		{
+			return;
+		}
+
+		TextureCache::BuildMipmaps(job.image, TextureArray::GetLevelCount(job.padding));
+	}
+	else
+	{
+		//the flip flag is per thread, so workers decoding other images are not affected
+		stbi_set_flip_vertically_on_load_thread(true);
+
+		int width{};
+		int height{};
+		int channels{};
+
+		//always RGBA, so every upload has the same format and 4 byte aligned rows
+		unsigned char* data = stbi_load(
+			sourcePaths.front().c_str(),
+			&width,
+			&height,
+			&channels,
+			4);
+
+		if (data == nullptr)
+		{
+			job.error = "it could not be decoded";
+			return;
+		}
+
+		DecodedImage& image = job.image;
+		image.width = static_cast<uint32_t>(width);
+		image.height = static_cast<uint32_t>(height);
+		image.storage.assign(data, data + image.GetLayerSize(0));
+		image.pixels = image.storage.data();
+		stbi_image_free(data);
+
+		TextureCache::BuildMipmaps(image, TextureCache::GetFullLevelCount(image.width, image.height));
+	}
+
+	if (hasKey) TextureCache::Store(job.name, key, job.image, job.cacheError);
+
+	job.isDecoded = true;
+}
+
+const void* Stage(
+	const unsigned char* pixels,
+	size_t size)
+{
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, stagingBuffer);
+
+	//orphaning hands the driver a fresh store, the previous upload may still be reading the old one
+	glBufferData(GL_PIXEL_UNPACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STREAM_DRAW);
+
+	void* mapped = glMapBufferRange(
+		GL_PIXEL_UNPACK_BUFFER,
+		0,
+		static_cast<GLsizeiptr>(size),
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+
+	if (mapped != nullptr)
+	{
+		memcpy(mapped, pixels, size);
+		if (glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE) return nullptr;
+	}
+
+	glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	return pixels;
+}
+
+void Submit(const shared_ptr<TextureLoadJob>& job)
+{
+	pendingCount++;
+
+	pool.Submit([job]()
+		{
+			Decode(*job);
+
+			lock_guard<mutex> lock(finishedMutex);
+			finishedJobs.push_back(job);
+		});
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//glm
+#include "glm/gtc/type_ptr.hpp"
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/uniformcache.hpp"
+#include "graphics/sceneuniforms.hpp"
+#include "graphics/glext.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::UniformCache;
+using CircuitGame::Graphics::SceneUniforms;
+
+using glm::value_ptr;
+using std::string;
+using std::to_string;
+using std::unordered_map;
+using std::vector;
+
+namespace CircuitGame::Graphics
+{
+	void UniformCache::Register(GLuint program)
+	{
+		unordered_map<string, GLint>& locations = programs[program];
+		locations.clear();
+
+		GLint uniformCount{};
+		GLint maxNameLength{};
+		glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		vector<char> nameBuffer(static_cast<size_t>(maxNameLength) + 1);
+
+		for (GLint i = 0; i < uniformCount; i++)
+		{
+			GLsizei length{};
+			GLint size{};
+			GLenum type{};
+			glGetActiveUniform(
+				program,
+				static_cast<GLuint>(i),
+				static_cast<GLsizei>(nameBuffer.size()),
+				&length,
+				&size,
+				&type,
+				nameBuffer.data());
+
+			//members of uniform blocks are active too but have no location
+			string name(nameBuffer.data(), static_cast<size_t>(length));
+			GLint location = glGetUniformLocation(program, name.c_str());
+			if (location < 0) continue;
+
+			locations[name] = location;
+
+			//arrays are reported as "name[0]", they are also reachable by their bare name
+			size_t bracket = name.rfind("[0]");
+			if (bracket != string::npos
+				&& bracket + 3 == name.size())
+			{
+				locations[name.substr(0, bracket)] = location;
+			}
+		}
+
+		SceneUniforms::BindBlocks(program);
+
+		Logger::Print(
+			"Cached '" + to_string(locations.size()) + "' uniform locations of program '" + to_string(program) + "'.",
+			"UNIFORM_CACHE",
+			LogType::LOG_DEBUG);
+	}
+
+	void UniformCache::Unregister(GLuint program)
+	{
+		programs.erase(program);
+	}
+
+	GLint UniformCache::GetLocation(
+		GLuint program,
+		const string& name)
+	{
+		auto found = programs.find(program);
+		if (found == programs.end())
+		{
+			Register(program);
+			found = programs.find(program);
+		}
+
+		auto location = found->second.find(name);
+		return location != found->second.end() ? location->second : -1;
+	}
+
+	void UniformCache::SetInt(GLuint program, const string& name, int value)
+	{
+		glUniform1i(GetLocation(program, name), value);
+	}
+	void UniformCache::SetFloat(GLuint program, const string& name, float value)
+	{
+		glUniform1f(GetLocation(program, name), value);
+	}
+	void UniformCache::SetVec2(GLuint program, const string& name, const vec2& value)
+	{
+		glUniform2fv(GetLocation(program, name), 1, value_ptr(value));
+	}
+	void UniformCache::SetVec3(GLuint program, const string& name, const vec3& value)
+	{
+		glUniform3fv(GetLocation(program, name), 1, value_ptr(value));
+	}
+	void UniformCache::SetVec4(GLuint program, const string& name, const vec4& value)
+	{
+		glUniform4fv(GetLocation(program, name), 1, value_ptr(value));
+	}
+	void UniformCache::SetMat4(GLuint program, const string& name, const mat4& value)
+	{
+		glUniformMatrix4fv(GetLocation(program, name), 1, GL_FALSE, value_ptr(value));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,463 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+#include "graphics/opengl/opengl_core.hpp"
+
+#include "graphics/wirerenderer.hpp"
+#include "graphics/glstate.hpp"
+#include "graphics/glext.hpp"
+#include "graphics/uniformcache.hpp"
+#include "graphics/netstatebuffer.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Graphics::WireRenderer;
+using CircuitGame::Graphics::WireSegment;
+using CircuitGame::Graphics::WireChunk;
+using CircuitGame::Graphics::Wire;
+using CircuitGame::Graphics::GLState;
+using CircuitGame::Graphics::UniformCache;
+using CircuitGame::Graphics::NET_STATE_TEXTURE_UNIT;
+using CircuitGame::Graphics::WIRE_CHUNK_SIDE;
+
+using glm::ivec2;
+using std::erase_if;
+using std::find;
+using std::max;
+using std::min;
+using std::swap;
+
+//Vertex attribute locations of wire.vert
+static constexpr GLuint CORNER_ATTRIBUTE = 0;
+static constexpr GLuint SEGMENT_ATTRIBUTE = 1;
+static constexpr GLuint NET_ATTRIBUTE = 2;
+
+//First cell of the chunk holding cell, rounding towards negative infinity
+static ivec2 GetChunkCell(const ivec2& cell);
+
+//Cuts the segment down to the part inside the box, returns false if nothing is left
+static bool ClipSegment(
+	vec2& start,
+	vec2& end,
+	const vec2& boxMin,
+	const vec2& boxMax);
+
+namespace CircuitGame::Graphics
+{
+	bool WireRenderer::Initialize(
+		const ShaderProgram* newShader,
+		float newCellSize,
+		float newHeight)
+	{
+		if (newShader == nullptr)
+		{
+			Logger::Print(
+				"Cannot initialize wire renderer because its shader is nullptr!",
+				"WIRE_RENDERER",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		shader = newShader;
+		cellSize = newCellSize;
+		height = newHeight;
+
+		//x runs from the start to the end of the segment, y from one side of the line to the other
+		const vec2 corners[6] =
+		{
+			vec2(0.0f, -1.0f), vec2(1.0f, -1.0f), vec2(1.0f, 1.0f),
+			vec2(0.0f, -1.0f), vec2(1.0f, 1.0f),  vec2(0.0f, 1.0f)
+		};
+
+		glGenBuffers(1, &cornerVBO);
+		glBindBuffer(GL_ARRAY_BUFFER, cornerVBO);
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			sizeof(corners),
+			corners,
+			GL_STATIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		if (!GLState::UseShader(shader)) return false;
+
+		UniformCache::SetInt(shader->GetProgramID(), "netStates", NET_STATE_TEXTURE_UNIT);
+
+		return true;
+	}
+
+	uint32_t WireRenderer::AddWire(
+		const vector<ivec2>& points,
+		uint32_t net)
+	{
+		uint32_t wireIndex{};
+		if (!freeWires.empty())
+		{
+			wireIndex = freeWires.back();
+			freeWires.pop_back();
+		}
+		else
+		{
+			wireIndex = static_cast<uint32_t>(wires.size());
+			wires.emplace_back();
+		}
+
+		Wire& wire = wires[wireIndex];
+		wire.points = points;
+		wire.net = net;
+		wire.chunks.clear();
+		wire.isAlive = true;
+
+		for (size_t i = 1; i < points.size(); i++)
+		{
+			ivec2 start = points[i - 1];
+			ivec2 end = points[i];
+			if (start == end) continue;
+
+			ivec2 firstChunk = GetChunkCell(glm::min(start, end));
+			ivec2 lastChunk = GetChunkCell(glm::max(start, end));
+
+			//straight runs cross a single row or column of chunks, diagonals may miss some of the box
+			for (int y = firstChunk.y; y <= lastChunk.y; y += WIRE_CHUNK_SIDE)
+			{
+				for (int x = firstChunk.x; x <= lastChunk.x; x += WIRE_CHUNK_SIDE)
+				{
+					vec2 clippedStart = vec2(start);
+					vec2 clippedEnd = vec2(end);
+					if (!ClipSegment(
+						clippedStart,
+						clippedEnd,
+						vec2(x, y) - 0.5f,
+						vec2(x + WIRE_CHUNK_SIDE, y + WIRE_CHUNK_SIDE) - 0.5f))
+					{
+						continue;
+					}
+
+					//may grow chunks, so nothing in it is held across this call
+					uint32_t chunkIndex = GetChunk(ivec2(x, y));
+					if (find(wire.chunks.begin(), wire.chunks.end(), chunkIndex) != wire.chunks.end()) continue;
+
+					wire.chunks.push_back(chunkIndex);
+
+					WireChunk& chunk = chunks[chunkIndex];
+					chunk.wires.push_back(wireIndex);
+					if (!chunk.isDirty)
+					{
+						chunk.isDirty = true;
+						dirtyChunks.push_back(chunkIndex);
+					}
+				}
+			}
+		}
+
+		wireCount++;
+
+		return wireIndex;
+	}
+
+	void WireRenderer::RemoveWire(uint32_t wire)
+	{
+		if (wire >= wires.size()
+			|| !wires[wire].isAlive)
+		{
+			return;
+		}
+
+		Wire& removed = wires[wire];
+		removed.isAlive = false;
+		removed.points.clear();
+
+		//the chunks drop the wire when they are rebuilt
+		for (uint32_t chunkIndex : removed.chunks)
+		{
+			WireChunk& chunk = chunks[chunkIndex];
+			if (!chunk.isDirty)
+			{
+				chunk.isDirty = true;
+				dirtyChunks.push_back(chunkIndex);
+			}
+		}
+
+		removedWires.push_back(wire);
+		wireCount--;
+	}
+
+	void WireRenderer::Clear()
+	{
+		for (uint32_t i = 0; i < chunks.size(); i++)
+		{
+			WireChunk& chunk = chunks[i];
+			chunk.wires.clear();
+			if (!chunk.isDirty)
+			{
+				chunk.isDirty = true;
+				dirtyChunks.push_back(i);
+			}
+		}
+
+		wires.clear();
+		freeWires.clear();
+		removedWires.clear();
+		wireCount = 0;
+	}
+
+	bool WireRenderer::Update()
+	{
+		if (dirtyChunks.empty()) return false;
+
+		for (uint32_t chunkIndex : dirtyChunks)
+		{
+			RebuildChunk(chunks[chunkIndex]);
+		}
+		dirtyChunks.clear();
+
+		//no chunk refers to them anymore, so the handles can be handed out again
+		freeWires.insert(
+			freeWires.end(),
+			removedWires.begin(),
+			removedWires.end());
+		removedWires.clear();
+
+		return true;
+	}
+
+	void WireRenderer::Cull(const Frustum& frustum)
+	{
+		culledChunks.clear();
+		visibleChunks.clear();
+
+		chunkCuller.Cull(frustum, culledChunks);
+
+		for (uint32_t chunkIndex : culledChunks)
+		{
+			if (chunks[chunkIndex].segmentCount > 0) visibleChunks.push_back(chunkIndex);
+		}
+	}
+
+	void WireRenderer::Draw()
+	{
+		if (visibleChunks.empty()
+			|| !GLState::UseShader(shader))
+		{
+			return;
+		}
+
+		unsigned int programID = shader->GetProgramID();
+		UniformCache::SetFloat(programID, "height", height);
+		UniformCache::SetFloat(programID, "lineWidth", lineWidth);
+
+		for (uint32_t chunkIndex : visibleChunks)
+		{
+			const WireChunk& chunk = chunks[chunkIndex];
+
+			GLState::BindVertexArray(chunk.vao);
+			glDrawArraysInstanced(
+				GL_TRIANGLES,
+				0,
+				6,
+				static_cast<GLsizei>(chunk.segmentCount));
+		}
+	}
+
+	void WireRenderer::Shutdown()
+	{
+		for (const WireChunk& chunk : chunks)
+		{
+			glDeleteVertexArrays(1, &chunk.vao);
+			GLState::OnVertexArrayDeleted(chunk.vao);
+			glDeleteBuffers(1, &chunk.vbo);
+		}
+		glDeleteBuffers(1, &cornerVBO);
+		cornerVBO = 0;
+
+		shader = nullptr;
+
+		wires.clear();
+		freeWires.clear();
+		removedWires.clear();
+		wireCount = 0;
+
+		chunks.clear();
+		chunkIndices.clear();
+		dirtyChunks.clear();
+		chunkCuller.Clear();
+
+		culledChunks.clear();
+		visibleChunks.clear();
+		segments.clear();
+	}
+
+	uint32_t WireRenderer::GetChunk(const ivec2& cell)
+	{
+		ivec2 firstCell = GetChunkCell(cell);
+
+		uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(firstCell.x)) << 32)
+			| static_cast<uint32_t>(firstCell.y);
+
+		auto found = chunkIndices.find(key);
+		if (found != chunkIndices.end()) return found->second;
+
+		WireChunk chunk{};
+		chunk.firstCell = firstCell;
+
+		glGenVertexArrays(1, &chunk.vao);
+		glGenBuffers(1, &chunk.vbo);
+
+		//the attributes never change, so the chunk VAO is set up once
+		GLState::BindVertexArray(chunk.vao);
+
+		glBindBuffer(GL_ARRAY_BUFFER, cornerVBO);
+		glVertexAttribPointer(
+			CORNER_ATTRIBUTE,
+			2,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(vec2),
+			(void*)0);
+		glEnableVertexAttribArray(CORNER_ATTRIBUTE);
+
+		glBindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
+		glVertexAttribPointer(
+			SEGMENT_ATTRIBUTE,
+			4,
+			GL_FLOAT,
+			GL_FALSE,
+			sizeof(WireSegment),
+			(void*)offsetof(WireSegment, start));
+		glEnableVertexAttribArray(SEGMENT_ATTRIBUTE);
+		glVertexAttribDivisor(SEGMENT_ATTRIBUTE, 1);
+
+		glVertexAttribIPointer(
+			NET_ATTRIBUTE,
+			1,
+			GL_UNSIGNED_INT,
+			sizeof(WireSegment),
+			(void*)offsetof(WireSegment, net));
+		glEnableVertexAttribArray(NET_ATTRIBUTE);
+		glVertexAttribDivisor(NET_ATTRIBUTE, 1);
+
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+		//lines are a few pixels wide, half a cell of slack covers them at any sensible zoom
+		vec2 boxMin = (vec2(firstCell) - 1.0f) * cellSize;
+		vec2 boxMax = (vec2(firstCell + WIRE_CHUNK_SIDE)) * cellSize;
+		chunkCuller.Add(
+			vec3(boxMin, height - cellSize * 0.5f),
+			vec3(boxMax, height + cellSize * 0.5f));
+
+		uint32_t chunkIndex = static_cast<uint32_t>(chunks.size());
+		chunks.push_back(chunk);
+		chunkIndices[key] = chunkIndex;
+
+		return chunkIndex;
+	}
+
+	void WireRenderer::RebuildChunk(WireChunk& chunk)
+	{
+		chunk.isDirty = false;
+
+		//removed wires leave the chunk here
+		erase_if(
+			chunk.wires,
+			[](uint32_t wire) { return !wires[wire].isAlive; });
+
+		vec2 boxMin = vec2(chunk.firstCell) - 0.5f;
+		vec2 boxMax = vec2(chunk.firstCell + WIRE_CHUNK_SIDE) - 0.5f;
+
+		//a wire crossing several chunks is cut at their borders, so no segment is drawn twice
+		segments.clear();
+		for (uint32_t wireIndex : chunk.wires)
+		{
+			const Wire& wire = wires[wireIndex];
+
+			for (size_t i = 1; i < wire.points.size(); i++)
+			{
+				vec2 start = vec2(wire.points[i - 1]);
+				vec2 end = vec2(wire.points[i]);
+				if (start == end
+					|| !ClipSegment(start, end, boxMin, boxMax))
+				{
+					continue;
+				}
+
+				segments.push_back({ start * cellSize, end * cellSize, wire.net });
+			}
+		}
+
+		chunk.segmentCount = static_cast<uint32_t>(segments.size());
+		if (segments.empty()) return;
+
+		glBindBuffer(GL_ARRAY_BUFFER, chunk.vbo);
+		glBufferData(
+			GL_ARRAY_BUFFER,
+			segments.size() * sizeof(WireSegment),
+			segments.data(),
+			GL_STATIC_DRAW);
+		glBindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+}
+
+ivec2 GetChunkCell(const ivec2& cell)
+{
+	auto floorToChunk = [](int value)
+		{
+			int chunk = value >= 0
+				? value / WIRE_CHUNK_SIDE
+				: (value - WIRE_CHUNK_SIDE + 1) / WIRE_CHUNK_SIDE;
+			return chunk * WIRE_CHUNK_SIDE;
+		};
+
+	return ivec2(floorToChunk(cell.x), floorToChunk(cell.y));
+}
+
+bool ClipSegment(
+	vec2& start,
+	vec2& end,
+	const vec2& boxMin,
+	const vec2& boxMax)
+{
+	vec2 direction = end - start;
+	float enter = 0.0f;
+	float leave = 1.0f;
+
+	for (int axis = 0; axis < 2; axis++)
+	{
+		if (direction[axis] == 0.0f)
+		{
+			if (start[axis] < boxMin[axis]
+				|| start[axis] > boxMax[axis])
+			{
+				return false;
+			}
+			continue;
+		}
+
+		float toMin = (boxMin[axis] - start[axis]) / direction[axis];
+		float toMax = (boxMax[axis] - start[axis]) / direction[axis];
+		if (toMin > toMax) swap(toMin, toMax);
+
+		enter = max(enter, toMin);
+		leave = min(leave, toMax);
+	}
+
+	//touching a corner leaves nothing to draw
+	if (enter >= leave) return false;
+
+	vec2 origin = start;
+	start = origin + direction * enter;
+	end = origin + direction * leave;
+
+	return true;
+}
\ No newline at end of file
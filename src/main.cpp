@@ -3,13 +3,19 @@
 //This is free software, and you are welcome to redistribute it under certain conditions.
 //Read LICENSE.md for more information.
 
+#include <string>
+#include <vector>
+
 #include "core/gamecore.hpp"
 
 using CircuitGame::Core::Game;
 
-int main()
+using std::string;
+using std::vector;
+
+int main(int argc, char* argv[])
 {
-	Game::Initialize();
+	Game::Initialize(vector<string>(argv + 1, argv + argc));
 
 	return 0;
 }
\ No newline at end of file
@@ -0,0 +1,704 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "simulation/board.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Simulation::Board;
+using CircuitGame::Simulation::Gate;
+using CircuitGame::Simulation::GateType;
+using CircuitGame::Simulation::ClockSource;
+using CircuitGame::Simulation::Memory;
+using CircuitGame::Simulation::MemoryPorts;
+
+using std::llround;
+using std::max;
+using std::min;
+using std::reverse;
+using std::move;
+using std::string;
+using std::to_string;
+using std::vector;
+
+namespace CircuitGame::Simulation
+{
+	uint32_t Board::AddNet()
+	{
+		isCompiled = false;
+
+		netStates.push_back(0);
+		return static_cast<uint32_t>(netStates.size() - 1);
+	}
+
+	uint32_t Board::AddGate(
+		GateType type,
+		const vector<uint32_t>& inputs,
+		uint32_t output)
+	{
+		isCompiled = false;
+
+		Gate gate
+		{
+			.type = type,
+			.firstInput = static_cast<uint32_t>(gateInputs.size()),
+			.inputCount = static_cast<uint32_t>(inputs.size()),
+			.output = output
+		};
+		gateInputs.insert(gateInputs.end(), inputs.begin(), inputs.end());
+
+		gates.push_back(gate);
+		return static_cast<uint32_t>(gates.size() - 1);
+	}
+
+	uint32_t Board::AddClock(
+		uint32_t net,
+		double frequency,
+		double phase)
+	{
+		if (frequency <= 0.0)
+		{
+			Logger::Print(
+				"Cannot add a clock with a frequency of zero or less!",
+				"BOARD",
+				LogType::LOG_ERROR,
+				2);
+
+			return UINT32_MAX;
+		}
+
+		isCompiled = false;
+
+		//one picosecond resolution, so anything above 500 GHz collapses to the fastest clock
+		double halfPeriod = 1e12 / (frequency * 2.0);
+
+		ClockSource clock
+		{
+			.net = net,
+			.halfPeriod = static_cast<uint64_t>(max<long long>(1, llround(halfPeriod))),
+			.phase = static_cast<uint64_t>(max<long long>(0, llround(phase * 1e12)))
+		};
+
+		clocks.push_back(clock);
+		return static_cast<uint32_t>(clocks.size() - 1);
+	}
+
+	uint32_t Board::AddMemory(
+		unique_ptr<Memory> memory,
+		const MemoryPorts& ports)
+	{
+		if (memory == nullptr)
+		{
+			Logger::Print(
+				"Cannot add a memory that is nullptr!",
+				"BOARD",
+				LogType::LOG_ERROR,
+				2);
+
+			return UINT32_MAX;
+		}
+
+		bool hasWritePort = !memory->IsReadOnly()
+			&& ports.writeEnable != NO_NET
+			&& ports.clock != NO_NET;
+
+		if (ports.address.empty()
+			|| ports.address.size() > 32
+			|| ports.dataOut.size() > memory->GetDataWidth()
+			|| (hasWritePort
+			&& ports.dataIn.size() != memory->GetDataWidth()))
+		{
+			Logger::Print(
+				"Cannot add memory '" + memory->GetName() + "' because its ports do not match its address or data width!",
+				"BOARD",
+				LogType::LOG_ERROR,
+				2);
+
+			return UINT32_MAX;
+		}
+
+		isCompiled = false;
+
+		uint32_t index = static_cast<uint32_t>(memories.size());
+
+		MemoryBinding binding{};
+		binding.addressWidth = static_cast<uint32_t>(ports.address.size());
+		binding.dataWidth = memory->GetDataWidth();
+		binding.firstReadGate = GetGateCount();
+		binding.memory = move(memory);
+
+		//one read gate per data bit keeps every gate single-output,
+		//so fanout, loop detection and isolation need no special cases
+		for (size_t bit = 0; bit < ports.dataOut.size(); bit++)
+		{
+			uint32_t gate = AddGate(GateType::memoryRead, ports.address, ports.dataOut[bit]);
+			gates[gate].bit = static_cast<uint8_t>(bit);
+			gates[gate].payload = index;
+		}
+
+		if (hasWritePort)
+		{
+			//inputs are clock, write enable, address bits, then data bits
+			vector<uint32_t> inputs{ ports.clock, ports.writeEnable };
+			inputs.insert(inputs.end(), ports.address.begin(), ports.address.end());
+			inputs.insert(inputs.end(), ports.dataIn.begin(), ports.dataIn.end());
+
+			uint32_t gate = AddGate(GateType::memoryWrite, inputs, NO_NET);
+			gates[gate].payload = index;
+		}
+
+		memories.push_back(move(binding));
+		return index;
+	}
+
+	bool Board::Compile()
+	{
+		uint32_t netCount = GetNetCount();
+		uint32_t gateCount = GetGateCount();
+
+		for (uint32_t i = 0; i < gateCount; i++)
+		{
+			const Gate& gate = gates[i];
+
+			bool isValid = gate.output < netCount
+				|| (gate.type == GateType::memoryWrite
+				&& gate.output == NO_NET);
+			for (uint32_t j = 0; j < gate.inputCount; j++)
+			{
+				if (gateInputs[gate.firstInput + j] >= netCount) isValid = false;
+			}
+
+			if (!isValid)
+			{
+				Logger::Print(
+					"Cannot compile board because gate '" + to_string(i) + "' references a net that does not exist!",
+					"BOARD",
+					LogType::LOG_ERROR,
+					2);
+
+				return false;
+			}
+		}
+
+		for (const ClockSource& clock : clocks)
+		{
+			if (clock.net >= netCount)
+			{
+				Logger::Print(
+					"Cannot compile board because a clock drives net '" + to_string(clock.net) + "' that does not exist!",
+					"BOARD",
+					LogType::LOG_ERROR,
+					2);
+
+				return false;
+			}
+		}
+
+		//count, prefix sum, then fill - keeps every fanout list contiguous
+
+		fanoutOffsets.assign(netCount + 1, 0);
+		for (uint32_t input : gateInputs) fanoutOffsets[input + 1]++;
+		for (uint32_t i = 0; i < netCount; i++) fanoutOffsets[i + 1] += fanoutOffsets[i];
+
+		fanoutGates.assign(gateInputs.size(), 0);
+		vector<uint32_t> fillPos(fanoutOffsets.begin(), fanoutOffsets.end() - 1);
+		for (uint32_t i = 0; i < gateCount; i++)
+		{
+			const Gate& gate = gates[i];
+			for (uint32_t j = 0; j < gate.inputCount; j++)
+			{
+				fanoutGates[fillPos[gateInputs[gate.firstInput + j]]++] = i;
+			}
+		}
+
+		isGateQueued.assign(gateCount, 0);
+		pendingGates.clear();
+
+		isGateIsolated.assign(gateCount, 0);
+		isNetOscillating.assign(netCount, 0);
+		oscillatingNets.clear();
+		isolatedGateCount = 0;
+
+		vector<uint32_t> settleOrder = FindLoops();
+
+		//one pass in topological order makes every loop-free gate agree with its inputs,
+		//settling with delta cycles from an arbitrary state could take quadratic time
+		for (uint32_t gateIndex : settleOrder)
+		{
+			const Gate& gate = gates[gateIndex];
+
+			//writes wait for the first rising edge after compiling
+			if (gate.type == GateType::memoryWrite)
+			{
+				memories[gate.payload].lastClock = netStates[gateInputs[gate.firstInput]];
+				continue;
+			}
+
+			netStates[gate.output] = EvaluateGate(gate) ? 1 : 0;
+
+			if (gateLoop[gateIndex] != NO_LOOP)
+			{
+				isGateQueued[gateIndex] = 1;
+				pendingGates.push_back(gateIndex);
+			}
+		}
+
+		isCompiled = true;
+
+		Logger::Print(
+			"Compiled board with '" + to_string(netCount) + "' nets and '" + to_string(gateCount) + "' gates.",
+			"BOARD",
+			LogType::LOG_DEBUG);
+
+		if (GetLoopCount() > 0)
+		{
+			Logger::Print(
+				"Board contains '" + to_string(GetLoopCount()) + "' combinational loops with '"
+				+ to_string(loopGates.size()) + "' gates in total. "
+				+ "Loops that do not settle within '" + to_string(deltaCycleBudget) + "' delta cycles will be isolated.",
+				"BOARD",
+				LogType::LOG_WARNING);
+		}
+
+		return true;
+	}
+
+	void Board::ClearIsolation()
+	{
+		if (isolatedGateCount == 0) return;
+
+		for (uint32_t i = 0; i < GetGateCount(); i++)
+		{
+			if (!isGateIsolated[i]) continue;
+
+			isGateIsolated[i] = 0;
+			if (!isGateQueued[i])
+			{
+				isGateQueued[i] = 1;
+				pendingGates.push_back(i);
+			}
+		}
+
+		for (uint32_t net : oscillatingNets) isNetOscillating[net] = 0;
+		oscillatingNets.clear();
+		isolatedGateCount = 0;
+	}
+
+	void Board::PackNetStates(vector<uint32_t>& bits) const
+	{
+		size_t netCount = netStates.size();
+		bits.assign((netCount + 31) / 32, 0);
+
+		//whole words without a per-net bounds check, the tail word after
+		size_t fullWords = netCount / 32;
+		for (size_t word = 0; word < fullWords; word++)
+		{
+			const uint8_t* states = netStates.data() + word * 32;
+
+			uint32_t packed = 0;
+			for (uint32_t bit = 0; bit < 32; bit++)
+			{
+				packed |= static_cast<uint32_t>(states[bit] != 0) << bit;
+			}
+			bits[word] = packed;
+		}
+
+		for (size_t net = fullWords * 32; net < netCount; net++)
+		{
+			bits[fullWords] |= static_cast<uint32_t>(netStates[net] != 0) << (net % 32);
+		}
+	}
+
+	void Board::SetNetState(uint32_t net, bool state)
+	{
+		uint8_t newState = state ? 1 : 0;
+		if (netStates[net] == newState) return;
+
+		netStates[net] = newState;
+		if (isCompiled) ScheduleFanout(net);
+	}
+
+	uint32_t Board::Step()
+	{
+		if (!isCompiled) return 0;
+
+		uint32_t deltaCycles = 0;
+
+		while (!pendingGates.empty())
+		{
+			//a loop that keeps switching would otherwise never let this step finish.
+			//Checked on every cycle past the budget, a chain deeper than the budget may only
+			//then reach a loop and start it switching. Loop-free logic settles within one cycle
+			//per gate, whatever is pending past that is frozen no matter what it is.
+			if (deltaCycles >= deltaCycleBudget
+				&& IsolateOscillation(deltaCycles - deltaCycleBudget >= gates.size()))
+			{
+				break;
+			}
+
+			deltaCycles++;
+
+			evaluatingGates.swap(pendingGates);
+			pendingGates.clear();
+
+			evaluationCount += evaluatingGates.size();
+
+			//past half the budget the board is most likely stuck in a symmetric race
+			//(an SR latch released from its forbidden state), committing outputs one gate
+			//at a time breaks the tie while a real oscillator keeps switching
+			if (deltaCycles > deltaCycleBudget / 2)
+			{
+				for (uint32_t gateIndex : evaluatingGates)
+				{
+					isGateQueued[gateIndex] = 0;
+
+					const Gate& gate = gates[gateIndex];
+					if (gate.type == GateType::memoryWrite)
+					{
+						EvaluateMemoryWrite(gate);
+						continue;
+					}
+
+					uint8_t result = EvaluateGate(gate) ? 1 : 0;
+					if (netStates[gate.output] != result)
+					{
+						netStates[gate.output] = result;
+						ScheduleFanout(gate.output);
+					}
+				}
+
+				continue;
+			}
+
+			//all gates of one delta cycle see the same input state,
+			//outputs are committed only after the whole cycle is evaluated
+			netChanges.clear();
+			for (uint32_t gateIndex : evaluatingGates)
+			{
+				isGateQueued[gateIndex] = 0;
+
+				const Gate& gate = gates[gateIndex];
+				if (gate.type == GateType::memoryWrite)
+				{
+					EvaluateMemoryWrite(gate);
+					continue;
+				}
+
+				uint8_t result = EvaluateGate(gate) ? 1 : 0;
+				if (netStates[gate.output] != result)
+				{
+					netChanges.push_back({ gate.output, result });
+				}
+			}
+
+			for (const NetChange& change : netChanges)
+			{
+				if (netStates[change.net] == change.state) continue;
+
+				netStates[change.net] = change.state;
+				ScheduleFanout(change.net);
+			}
+		}
+
+		return deltaCycles;
+	}
+
+	bool Board::EvaluateGate(const Gate& gate) const
+	{
+		const uint32_t* inputs = gateInputs.data() + gate.firstInput;
+
+		if (gate.type == GateType::memoryRead)
+		{
+			uint32_t address = 0;
+			for (uint32_t i = 0; i < gate.inputCount; i++)
+			{
+				address |= static_cast<uint32_t>(netStates[inputs[i]]) << i;
+			}
+
+			uint32_t word = memories[gate.payload].memory->Read(address);
+			return ((word >> gate.bit) & 1) != 0;
+		}
+
+		uint32_t highCount = 0;
+		for (uint32_t i = 0; i < gate.inputCount; i++)
+		{
+			highCount += netStates[inputs[i]];
+		}
+
+		switch (gate.type)
+		{
+		case GateType::buffer:
+			return highCount != 0;
+		case GateType::notGate:
+			return highCount == 0;
+		case GateType::andGate:
+			return highCount == gate.inputCount;
+		case GateType::orGate:
+			return highCount != 0;
+		case GateType::xorGate:
+			return (highCount & 1) != 0;
+		case GateType::nandGate:
+			return highCount != gate.inputCount;
+		case GateType::norGate:
+			return highCount == 0;
+		case GateType::xnorGate:
+			return (highCount & 1) == 0;
+		case GateType::memoryRead:
+		case GateType::memoryWrite:
+			break;
+		}
+
+		return false;
+	}
+
+	void Board::EvaluateMemoryWrite(const Gate& gate)
+	{
+		MemoryBinding& binding = memories[gate.payload];
+		const uint32_t* inputs = gateInputs.data() + gate.firstInput;
+
+		uint8_t clock = netStates[inputs[0]];
+		bool isRisingEdge = clock && !binding.lastClock;
+		binding.lastClock = clock;
+
+		if (!isRisingEdge
+			|| !netStates[inputs[1]])
+		{
+			return;
+		}
+
+		const uint32_t* addressNets = inputs + 2;
+		const uint32_t* dataNets = addressNets + binding.addressWidth;
+
+		uint32_t address = 0;
+		for (uint32_t i = 0; i < binding.addressWidth; i++)
+		{
+			address |= static_cast<uint32_t>(netStates[addressNets[i]]) << i;
+		}
+
+		uint32_t value = 0;
+		for (uint32_t i = 0; i < binding.dataWidth; i++)
+		{
+			value |= static_cast<uint32_t>(netStates[dataNets[i]]) << i;
+		}
+
+		binding.memory->Write(address, value);
+
+		//read gates are created right after each other and only exist for connected data bits
+		for (uint32_t i = binding.firstReadGate; i < GetGateCount(); i++)
+		{
+			const Gate& readGate = gates[i];
+			if (readGate.type != GateType::memoryRead
+				|| readGate.payload != gate.payload)
+			{
+				break;
+			}
+
+			ScheduleGate(i);
+		}
+	}
+
+	void Board::ScheduleGate(uint32_t gateIndex)
+	{
+		if (isGateQueued[gateIndex]
+			|| isGateIsolated[gateIndex])
+		{
+			return;
+		}
+
+		isGateQueued[gateIndex] = 1;
+		pendingGates.push_back(gateIndex);
+	}
+
+	void Board::ScheduleFanout(uint32_t net)
+	{
+		for (uint32_t i = fanoutOffsets[net]; i < fanoutOffsets[net + 1]; i++)
+		{
+			ScheduleGate(fanoutGates[i]);
+		}
+	}
+	vector<uint32_t> Board::FindLoops()
+	{
+		uint32_t gateCount = GetGateCount();
+
+		//components complete in reverse topological order
+		vector<uint32_t> settleOrder{};
+		settleOrder.reserve(gateCount);
+
+		gateLoop.assign(gateCount, NO_LOOP);
+		loopOffsets.assign(1, 0);
+		loopGates.clear();
+
+		constexpr uint32_t UNVISITED = UINT32_MAX;
+
+		vector<uint32_t> index(gateCount, UNVISITED);
+		vector<uint32_t> lowLink(gateCount, 0);
+		vector<uint8_t> isOnStack(gateCount, 0);
+		vector<uint32_t> sccStack{};
+
+		//explicit call stack, next is the position in the fanout list of the gate output
+		struct Frame
+		{
+			uint32_t gate;
+			uint32_t next;
+		};
+		vector<Frame> callStack{};
+
+		uint32_t nextIndex = 0;
+
+		auto visit = [&](uint32_t gate)
+			{
+				index[gate] = nextIndex;
+				lowLink[gate] = nextIndex;
+				nextIndex++;
+
+				sccStack.push_back(gate);
+				isOnStack[gate] = 1;
+
+				//gates without an output net have no successors
+				uint32_t net = gates[gate].output;
+				callStack.push_back({ gate, net == NO_NET ? 0 : fanoutOffsets[net] });
+			};
+
+		for (uint32_t root = 0; root < gateCount; root++)
+		{
+			if (index[root] != UNVISITED) continue;
+
+			visit(root);
+
+			while (!callStack.empty())
+			{
+				Frame& frame = callStack.back();
+				uint32_t gate = frame.gate;
+				uint32_t net = gates[gate].output;
+
+				if (net != NO_NET
+					&& frame.next < fanoutOffsets[net + 1])
+				{
+					uint32_t successor = fanoutGates[frame.next++];
+
+					if (index[successor] == UNVISITED) visit(successor);
+					else if (isOnStack[successor])
+					{
+						lowLink[gate] = min(lowLink[gate], index[successor]);
+					}
+
+					continue;
+				}
+
+				callStack.pop_back();
+				if (!callStack.empty())
+				{
+					uint32_t parent = callStack.back().gate;
+					lowLink[parent] = min(lowLink[parent], lowLink[gate]);
+				}
+
+				if (lowLink[gate] != index[gate]) continue;
+
+				//gate is the root of a component, pop it off the stack
+
+				size_t componentStart = sccStack.size();
+				do componentStart--;
+				while (sccStack[componentStart] != gate);
+
+				size_t componentSize = sccStack.size() - componentStart;
+
+				bool isSelfLoop = false;
+				if (componentSize == 1
+					&& net != NO_NET)
+				{
+					for (uint32_t i = fanoutOffsets[net]; i < fanoutOffsets[net + 1]; i++)
+					{
+						if (fanoutGates[i] == gate) isSelfLoop = true;
+					}
+				}
+
+				if (componentSize > 1
+					|| isSelfLoop)
+				{
+					uint32_t loop = GetLoopCount();
+					for (size_t i = componentStart; i < sccStack.size(); i++)
+					{
+						gateLoop[sccStack[i]] = loop;
+						loopGates.push_back(sccStack[i]);
+					}
+					loopOffsets.push_back(static_cast<uint32_t>(loopGates.size()));
+				}
+
+				for (size_t i = componentStart; i < sccStack.size(); i++)
+				{
+					isOnStack[sccStack[i]] = 0;
+					settleOrder.push_back(sccStack[i]);
+				}
+				sccStack.resize(componentStart);
+			}
+		}
+
+		reverse(settleOrder.begin(), settleOrder.end());
+		return settleOrder;
+	}
+
+	bool Board::IsolateOscillation(bool isForced)
+	{
+		auto isolate = [&](uint32_t gate)
+			{
+				if (isGateIsolated[gate]) return;
+
+				isGateIsolated[gate] = 1;
+				isolatedGateCount++;
+
+				uint32_t net = gates[gate].output;
+				if (net != NO_NET
+					&& !isNetOscillating[net])
+				{
+					isNetOscillating[net] = 1;
+					oscillatingNets.push_back(net);
+				}
+			};
+
+		//only loops can keep switching, gates downstream of them merely follow
+		bool hasLoopGate = false;
+		for (uint32_t gate : pendingGates)
+		{
+			uint32_t loop = gateLoop[gate];
+			if (loop == NO_LOOP) continue;
+
+			hasLoopGate = true;
+			for (uint32_t i = loopOffsets[loop]; i < loopOffsets[loop + 1]; i++)
+			{
+				isolate(loopGates[i]);
+			}
+		}
+
+		//loop-free logic always settles, at most one delta cycle per level of depth
+		if (!hasLoopGate)
+		{
+			if (!isForced) return false;
+
+			//should not happen after a fresh Compile, but never leave the step unbounded
+			for (uint32_t gate : pendingGates) isolate(gate);
+		}
+
+		//downstream gates stay pending and settle on the frozen values next step
+		vector<uint32_t> stillPending{};
+		for (uint32_t gate : pendingGates)
+		{
+			if (isGateIsolated[gate]) isGateQueued[gate] = 0;
+			else stillPending.push_back(gate);
+		}
+		pendingGates.swap(stillPending);
+
+		return true;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,689 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "simulation/boardgenerator.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Simulation::BoardGenerator;
+using CircuitGame::Simulation::Board;
+using CircuitGame::Simulation::GateType;
+using CircuitGame::Simulation::StressBoard;
+using CircuitGame::Simulation::FanoutDistribution;
+using CircuitGame::Simulation::GeneratorSettings;
+
+using std::chrono::steady_clock;
+using std::chrono::duration;
+using std::ceil;
+using std::floor;
+using std::max;
+using std::min;
+using std::pow;
+using std::sqrt;
+using std::mt19937_64;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+using std::geometric_distribution;
+using std::string;
+using std::to_string;
+using std::stod;
+using std::stoull;
+using std::vector;
+
+//Largest fan-out a single net gets from the power law distribution
+static constexpr uint32_t MAX_POWER_LAW_FANOUT = 4096;
+
+//Input clocks are divided by up to 2^15, so the slowest one still toggles
+//within a reasonable benchmark run
+static constexpr uint32_t MAX_CLOCK_DIVIDER_SHIFT = 15;
+
+//Drives each primary input with a clock at the given activity,
+//input i runs at frequency / 2^i so adders and multipliers see counting operands
+static void DriveInputs(
+	Board& board,
+	const vector<uint32_t>& inputs,
+	const GeneratorSettings& settings,
+	mt19937_64& random);
+
+//sum = a ^ b ^ carryIn, carryOut = (a & b) | (carryIn & (a ^ b))
+static void AddFullAdder(
+	Board& board,
+	uint32_t a,
+	uint32_t b,
+	uint32_t carryIn,
+	uint32_t sum,
+	uint32_t carryOut);
+
+//Master-slave D flip-flop from two gated NAND latches, q follows d on the rising clock edge.
+//The master is open while the clock is low. Its enable comes through the inverter on notClock,
+//so on the rising edge the slave opens at once and the master closes one delta cycle later.
+//The master still holds the value from before the edge, since d is driven by slave outputs
+//that change two delta cycles after the edge at the earliest.
+static uint32_t AddFlipFlop(
+	Board& board,
+	uint32_t d,
+	uint32_t clock,
+	uint32_t notClock);
+
+static bool IsPositiveNumber(
+	const string& value,
+	double& result);
+
+//Unsigned integer without sign, fraction or exponent, the whole string must be digits
+static bool IsWholeNumber(
+	const string& value,
+	uint64_t& result);
+
+static bool IsGeneratorArgument(const string& name);
+
+namespace CircuitGame::Simulation
+{
+	bool BoardGenerator::Generate(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		if (settings.size == 0
+			|| settings.frequency <= 0.0
+			|| settings.activity < 0.0
+			|| settings.activity > 1.0
+			|| settings.fanoutMean < 1.0
+			|| settings.dagDepth == 0)
+		{
+			Logger::Print(
+				"Cannot generate stress board '" + ToString(settings.type) + "' because its settings are out of range!",
+				"BOARD_GENERATOR",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		if (settings.type == StressBoard::lfsrBank
+			&& (settings.lfsrWidth < 3
+			|| settings.lfsrWidth > 32))
+		{
+			Logger::Print(
+				"Cannot generate LFSR bank with a width of '" + to_string(settings.lfsrWidth) + "' bits, it must be 3 to 32!",
+				"BOARD_GENERATOR",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		uint32_t firstGate = board.GetGateCount();
+		auto start = steady_clock::now();
+
+		switch (settings.type)
+		{
+		case StressBoard::rippleAdder: AddRippleAdder(board, settings); break;
+		case StressBoard::arrayMultiplier: AddArrayMultiplier(board, settings); break;
+		case StressBoard::lfsrBank: AddLfsrBank(board, settings); break;
+		case StressBoard::randomDag: AddRandomDag(board, settings); break;
+		case StressBoard::gateGrid: AddGateGrid(board, settings); break;
+		}
+
+		duration<double> elapsed = steady_clock::now() - start;
+
+		Logger::Print(
+			"Generated stress board '" + ToString(settings.type) + "' with '"
+			+ to_string(board.GetGateCount() - firstGate) + "' gates in '"
+			+ to_string(elapsed.count()) + "' seconds.",
+			"BOARD_GENERATOR",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+
+	bool BoardGenerator::ParseArguments(
+		const vector<string>& arguments,
+		GeneratorSettings& settings)
+	{
+		for (size_t i = 0; i < arguments.size(); i++)
+		{
+			const string& name = arguments[i];
+			if (!IsGeneratorArgument(name)) continue;
+
+			if (i + 1 >= arguments.size())
+			{
+				Logger::Print(
+					"Argument '" + name + "' is missing its value!\n" + GetUsage(),
+					"BOARD_GENERATOR",
+					LogType::LOG_ERROR,
+					2);
+
+				return false;
+			}
+
+			const string& value = arguments[++i];
+			double number{};
+			bool isValid = true;
+
+			if (name == "--board")
+			{
+				if (value == "adder") settings.type = StressBoard::rippleAdder;
+				else if (value == "multiplier") settings.type = StressBoard::arrayMultiplier;
+				else if (value == "lfsr") settings.type = StressBoard::lfsrBank;
+				else if (value == "dag") settings.type = StressBoard::randomDag;
+				else if (value == "grid") settings.type = StressBoard::gateGrid;
+				else isValid = false;
+			}
+			else if (name == "--fanout")
+			{
+				if (value == "fixed") settings.fanout = FanoutDistribution::fixed;
+				else if (value == "geometric") settings.fanout = FanoutDistribution::geometric;
+				else if (value == "powerlaw") settings.fanout = FanoutDistribution::powerLaw;
+				else isValid = false;
+			}
+			else if (name == "--activity")
+			{
+				isValid = IsPositiveNumber(value, number)
+					&& number <= 1.0;
+				if (isValid) settings.activity = number;
+			}
+			else if (name == "--seed")
+			{
+				isValid = IsWholeNumber(value, settings.seed);
+			}
+			else
+			{
+				isValid = IsPositiveNumber(value, number)
+					&& number > 0.0;
+
+				if (isValid)
+				{
+					if (name == "--size") settings.size = static_cast<uint32_t>(min(number, 4e9));
+					else if (name == "--lfsr-width") settings.lfsrWidth = static_cast<uint32_t>(min(number, 64.0));
+					else if (name == "--fanout-mean") settings.fanoutMean = number;
+					else if (name == "--depth") settings.dagDepth = static_cast<uint32_t>(min(number, 4e9));
+					else if (name == "--frequency") settings.frequency = number;
+				}
+			}
+
+			if (!isValid)
+			{
+				Logger::Print(
+					"Argument '" + name + "' has an invalid value '" + value + "'!\n" + GetUsage(),
+					"BOARD_GENERATOR",
+					LogType::LOG_ERROR,
+					2);
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	bool BoardGenerator::HasArguments(const vector<string>& arguments)
+	{
+		for (const string& argument : arguments)
+		{
+			if (IsGeneratorArgument(argument)) return true;
+		}
+
+		return false;
+	}
+
+	string BoardGenerator::GetUsage()
+	{
+		return
+			"stress board arguments:\n"
+			"  --board adder|multiplier|lfsr|dag|grid\n"
+			"  --size N             bit width, LFSR count or gate count\n"
+			"  --lfsr-width N       bits per LFSR, 3 to 32\n"
+			"  --fanout fixed|geometric|powerlaw\n"
+			"  --fanout-mean N      average gates per net in random DAGs\n"
+			"  --depth N            gate levels of random DAGs\n"
+			"  --frequency HZ       fastest input clock\n"
+			"  --activity 0-1       share of inputs driven by a clock\n"
+			"  --seed N";
+	}
+
+	string BoardGenerator::ToString(StressBoard type)
+	{
+		switch (type)
+		{
+		case StressBoard::rippleAdder: return "ripple adder";
+		case StressBoard::arrayMultiplier: return "array multiplier";
+		case StressBoard::lfsrBank: return "LFSR bank";
+		case StressBoard::randomDag: return "random DAG";
+		case StressBoard::gateGrid: return "gate grid";
+		}
+
+		return "unknown";
+	}
+
+	void BoardGenerator::AddRippleAdder(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		mt19937_64 random(settings.seed);
+
+		uint32_t bits = settings.size;
+
+		vector<uint32_t> inputs{};
+		vector<uint32_t> a{};
+		vector<uint32_t> b{};
+		for (uint32_t i = 0; i < bits; i++)
+		{
+			a.push_back(board.AddNet());
+			b.push_back(board.AddNet());
+		}
+		inputs.insert(inputs.end(), a.begin(), a.end());
+		inputs.insert(inputs.end(), b.begin(), b.end());
+
+		//never driven, so it stays low
+		uint32_t carry = board.AddNet();
+
+		for (uint32_t i = 0; i < bits; i++)
+		{
+			uint32_t sum = board.AddNet();
+			uint32_t carryOut = board.AddNet();
+
+			AddFullAdder(board, a[i], b[i], carry, sum, carryOut);
+			carry = carryOut;
+		}
+
+		DriveInputs(board, inputs, settings, random);
+	}
+
+	void BoardGenerator::AddArrayMultiplier(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		mt19937_64 random(settings.seed);
+
+		uint32_t bits = settings.size;
+
+		vector<uint32_t> a{};
+		vector<uint32_t> b{};
+		for (uint32_t i = 0; i < bits; i++)
+		{
+			a.push_back(board.AddNet());
+			b.push_back(board.AddNet());
+		}
+
+		uint32_t zero = board.AddNet();
+
+		//row i holds the running sum of the first i + 1 partial products,
+		//bit j of the row is weighted 2^(i + j)
+		vector<uint32_t> row(bits, zero);
+		uint32_t rowCarry = zero;
+
+		for (uint32_t i = 0; i < bits; i++)
+		{
+			vector<uint32_t> product(bits);
+			for (uint32_t j = 0; j < bits; j++)
+			{
+				product[j] = board.AddNet();
+				board.AddGate(GateType::andGate, { a[j], b[i] }, product[j]);
+			}
+
+			if (i == 0)
+			{
+				row = product;
+				continue;
+			}
+
+			//the lowest bit of the previous row is final, the rest shifts down by one
+			vector<uint32_t> shifted(row.begin() + 1, row.end());
+			shifted.push_back(rowCarry);
+
+			vector<uint32_t> next(bits);
+			uint32_t carry = zero;
+			for (uint32_t j = 0; j < bits; j++)
+			{
+				next[j] = board.AddNet();
+				uint32_t carryOut = board.AddNet();
+
+				AddFullAdder(board, product[j], shifted[j], carry, next[j], carryOut);
+				carry = carryOut;
+			}
+
+			row = next;
+			rowCarry = carry;
+		}
+
+		vector<uint32_t> inputs(a);
+		inputs.insert(inputs.end(), b.begin(), b.end());
+		DriveInputs(board, inputs, settings, random);
+	}
+
+	void BoardGenerator::AddLfsrBank(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		//maximal length XNOR taps for 3 to 32 bits, from Xilinx XAPP052,
+		//XNOR feedback makes all zeroes a valid state so no seeding logic is needed
+		static const vector<vector<uint32_t>> taps
+		{
+			{ 3, 2 }, { 4, 3 }, { 5, 3 }, { 6, 5 }, { 7, 6 }, { 8, 6, 5, 4 },
+			{ 9, 5 }, { 10, 7 }, { 11, 9 }, { 12, 6, 4, 1 }, { 13, 4, 3, 1 },
+			{ 14, 5, 3, 1 }, { 15, 14 }, { 16, 15, 13, 4 }, { 17, 14 }, { 18, 11 },
+			{ 19, 6, 2, 1 }, { 20, 17 }, { 21, 19 }, { 22, 21 }, { 23, 18 },
+			{ 24, 23, 22, 17 }, { 25, 22 }, { 26, 6, 2, 1 }, { 27, 5, 2, 1 },
+			{ 28, 25 }, { 29, 27 }, { 30, 6, 4, 1 }, { 31, 28 }, { 32, 22, 2, 1 }
+		};
+
+		mt19937_64 random(settings.seed);
+
+		uint32_t width = settings.lfsrWidth;
+		const vector<uint32_t>& lfsrTaps = taps[width - 3];
+
+		vector<uint32_t> clocks{};
+		for (uint32_t r = 0; r < settings.size; r++)
+		{
+			uint32_t clock = board.AddNet();
+			uint32_t notClock = board.AddNet();
+			board.AddGate(GateType::notGate, { clock }, notClock);
+			clocks.push_back(clock);
+
+			uint32_t feedback = board.AddNet();
+
+			//stage 0 shifts in the feedback, stage i reads stage i - 1
+			vector<uint32_t> stages{};
+			uint32_t d = feedback;
+			for (uint32_t i = 0; i < width; i++)
+			{
+				d = AddFlipFlop(board, d, clock, notClock);
+				stages.push_back(d);
+			}
+
+			vector<uint32_t> tapNets{};
+			for (uint32_t tap : lfsrTaps) tapNets.push_back(stages[tap - 1]);
+
+			board.AddGate(GateType::xnorGate, tapNets, feedback);
+		}
+
+		//every register gets its own clock domain, which also exercises the scheduler
+		DriveInputs(board, clocks, settings, random);
+	}
+
+	void BoardGenerator::AddRandomDag(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		static const GateType types[]
+		{
+			GateType::andGate, GateType::orGate, GateType::xorGate,
+			GateType::nandGate, GateType::norGate, GateType::xnorGate
+		};
+
+		mt19937_64 random(settings.seed);
+
+		//gates are built level by level, so the depth is known up front instead of
+		//growing with the gate count, and every level is as wide as the input layer
+		uint32_t gateCount = settings.size;
+		uint32_t depth = min(settings.dagDepth, gateCount);
+		uint32_t width = (gateCount + depth - 1) / depth;
+		uint32_t inputCount = max<uint32_t>(2, width);
+
+		double mean = settings.fanoutMean;
+		geometric_distribution<uint32_t> geometric(1.0 / mean);
+		uniform_real_distribution<double> unit(0.0, 1.0);
+
+		//Pareto with a minimum of one, its exponent chosen so the mean matches
+		double paretoExponent = mean > 1.0 ? mean / (mean - 1.0) : 64.0;
+
+		auto sampleFanout = [&]() -> uint32_t
+			{
+				switch (settings.fanout)
+				{
+				case FanoutDistribution::fixed:
+					return static_cast<uint32_t>(mean + 0.5);
+				case FanoutDistribution::geometric:
+					return geometric(random) + 1;
+				case FanoutDistribution::powerLaw:
+				{
+					double sample = pow(1.0 - unit(random), -1.0 / paretoExponent);
+					return static_cast<uint32_t>(min(sample, static_cast<double>(MAX_POWER_LAW_FANOUT)));
+				}
+				}
+
+				return 1;
+			};
+
+		//every net adds as many open slots as its sampled fan-out once its level is done,
+		//gates take their inputs from random open slots of earlier levels,
+		//so the graph stays acyclic and the fan-out follows the distribution
+		vector<uint32_t> openSlots{};
+		vector<uint32_t> nets{};
+		vector<uint32_t> level{};
+
+		auto addSource = [&](uint32_t net)
+			{
+				nets.push_back(net);
+				openSlots.insert(openSlots.end(), sampleFanout(), net);
+			};
+
+		vector<uint32_t> inputs{};
+		for (uint32_t i = 0; i < inputCount; i++)
+		{
+			inputs.push_back(board.AddNet());
+			addSource(inputs.back());
+		}
+
+		//fan-in averages the fan-out mean, every gate output is a net
+		uint32_t lowFanIn = max<uint32_t>(1, static_cast<uint32_t>(floor(mean)));
+		double highChance = mean - floor(mean);
+
+		vector<uint32_t> gateInputs{};
+		for (uint32_t g = 0; g < gateCount; g++)
+		{
+			if (level.size() == width)
+			{
+				for (uint32_t net : level) addSource(net);
+				level.clear();
+			}
+
+			uint32_t fanIn = lowFanIn + (unit(random) < highChance ? 1 : 0);
+
+			gateInputs.clear();
+			for (uint32_t i = 0; i < fanIn; i++)
+			{
+				if (openSlots.empty())
+				{
+					uniform_int_distribution<size_t> pick(0, nets.size() - 1);
+					gateInputs.push_back(nets[pick(random)]);
+					continue;
+				}
+
+				uniform_int_distribution<size_t> pick(0, openSlots.size() - 1);
+				size_t slot = pick(random);
+
+				gateInputs.push_back(openSlots[slot]);
+				openSlots[slot] = openSlots.back();
+				openSlots.pop_back();
+			}
+
+			GateType type = fanIn == 1
+				? GateType::notGate
+				: types[uniform_int_distribution<size_t>(0, 5)(random)];
+
+			uint32_t output = board.AddNet();
+			board.AddGate(type, gateInputs, output);
+
+			level.push_back(output);
+		}
+
+		DriveInputs(board, inputs, settings, random);
+	}
+
+	void BoardGenerator::AddGateGrid(
+		Board& board,
+		const GeneratorSettings& settings)
+	{
+		static const GateType types[]
+		{
+			GateType::andGate, GateType::orGate, GateType::xorGate,
+			GateType::nandGate, GateType::norGate, GateType::xnorGate
+		};
+
+		mt19937_64 random(settings.seed);
+		uniform_int_distribution<size_t> pickType(0, 5);
+
+		uint32_t side = max<uint32_t>(1, static_cast<uint32_t>(ceil(sqrt(static_cast<double>(settings.size)))));
+
+		//one input per row on the left edge and one per column on the top edge
+		vector<uint32_t> inputs{};
+		vector<uint32_t> above(side);
+		for (uint32_t x = 0; x < side; x++)
+		{
+			above[x] = board.AddNet();
+			inputs.push_back(above[x]);
+		}
+
+		for (uint32_t y = 0; y < side; y++)
+		{
+			uint32_t left = board.AddNet();
+			inputs.push_back(left);
+
+			for (uint32_t x = 0; x < side; x++)
+			{
+				uint32_t output = board.AddNet();
+				board.AddGate(types[pickType(random)], { left, above[x] }, output);
+
+				left = output;
+				above[x] = output;
+			}
+		}
+
+		DriveInputs(board, inputs, settings, random);
+	}
+}
+
+void DriveInputs(
+	Board& board,
+	const vector<uint32_t>& inputs,
+	const GeneratorSettings& settings,
+	mt19937_64& random)
+{
+	uniform_real_distribution<double> unit(0.0, 1.0);
+
+	for (size_t i = 0; i < inputs.size(); i++)
+	{
+		if (unit(random) >= settings.activity) continue;
+
+		double frequency = settings.frequency / static_cast<double>(1u << (i % (MAX_CLOCK_DIVIDER_SHIFT + 1)));
+
+		//a random phase keeps unrelated inputs from all switching on the same time point
+		double phase = unit(random) / frequency;
+
+		board.AddClock(inputs[i], frequency, phase);
+	}
+}
+
+void AddFullAdder(
+	Board& board,
+	uint32_t a,
+	uint32_t b,
+	uint32_t carryIn,
+	uint32_t sum,
+	uint32_t carryOut)
+{
+	uint32_t halfSum = board.AddNet();
+	uint32_t halfCarry = board.AddNet();
+	uint32_t propagated = board.AddNet();
+
+	board.AddGate(GateType::xorGate, { a, b }, halfSum);
+	board.AddGate(GateType::xorGate, { halfSum, carryIn }, sum);
+	board.AddGate(GateType::andGate, { a, b }, halfCarry);
+	board.AddGate(GateType::andGate, { halfSum, carryIn }, propagated);
+	board.AddGate(GateType::orGate, { halfCarry, propagated }, carryOut);
+}
+
+uint32_t AddFlipFlop(
+	Board& board,
+	uint32_t d,
+	uint32_t clock,
+	uint32_t notClock)
+{
+	auto addLatch = [&board](uint32_t data, uint32_t enable)
+		{
+			uint32_t notData = board.AddNet();
+			uint32_t set = board.AddNet();
+			uint32_t reset = board.AddNet();
+			uint32_t q = board.AddNet();
+			uint32_t notQ = board.AddNet();
+
+			board.AddGate(GateType::notGate, { data }, notData);
+			board.AddGate(GateType::nandGate, { data, enable }, set);
+			board.AddGate(GateType::nandGate, { notData, enable }, reset);
+			board.AddGate(GateType::nandGate, { set, notQ }, q);
+			board.AddGate(GateType::nandGate, { reset, q }, notQ);
+
+			return q;
+		};
+
+	uint32_t master = addLatch(d, notClock);
+	return addLatch(master, clock);
+}
+
+bool IsPositiveNumber(
+	const string& value,
+	double& result)
+{
+	try
+	{
+		size_t used{};
+		result = stod(value, &used);
+		return used == value.size()
+			&& result >= 0.0;
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+bool IsWholeNumber(
+	const string& value,
+	uint64_t& result)
+{
+	//stoull would skip leading spaces and wrap a minus sign around
+	if (value.empty()
+		|| value[0] < '0'
+		|| value[0] > '9')
+	{
+		return false;
+	}
+
+	try
+	{
+		size_t used{};
+		result = stoull(value, &used);
+		return used == value.size();
+	}
+	catch (...)
+	{
+		return false;
+	}
+}
+
+bool IsGeneratorArgument(const string& name)
+{
+	return name == "--board"
+		|| name == "--size"
+		|| name == "--lfsr-width"
+		|| name == "--fanout"
+		|| name == "--fanout-mean"
+		|| name == "--depth"
+		|| name == "--frequency"
+		|| name == "--activity"
+		|| name == "--seed";
+}
\ No newline at end of file
@@ -0,0 +1,276 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "simulation/memory.hpp"
+#include "core/mappedfile.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Simulation::Memory;
+using CircuitGame::Core::MappedFile;
+
+using std::all_of;
+using std::min;
+using std::memcpy;
+using std::move;
+using std::unique_ptr;
+using std::make_unique;
+using std::string;
+using std::to_string;
+
+static bool IsValidDataWidth(
+	const string& name,
+	uint32_t dataWidth);
+
+namespace CircuitGame::Simulation
+{
+	unique_ptr<Memory> Memory::CreateRam(
+		const string& name,
+		uint32_t wordCount,
+		uint32_t dataWidth)
+	{
+		if (!IsValidDataWidth(name, dataWidth)) return nullptr;
+
+		if (wordCount == 0)
+		{
+			Logger::Print(
+				"Cannot create memory '" + name + "' with no words!",
+				"MEMORY",
+				LogType::LOG_ERROR,
+				2);
+
+			return nullptr;
+		}
+
+		unique_ptr<Memory> memory = Allocate(name, wordCount, dataWidth);
+
+		Logger::Print(
+			"Created RAM '" + name + "' with '" + to_string(wordCount) + "' words of '" + to_string(dataWidth) + "' bits.",
+			"MEMORY",
+			LogType::LOG_DEBUG);
+
+		return memory;
+	}
+
+	unique_ptr<Memory> Memory::Allocate(
+		const string& name,
+		uint32_t wordCount,
+		uint32_t dataWidth)
+	{
+		unique_ptr<Memory> memory = make_unique<Memory>();
+		memory->name = name;
+		memory->wordCount = wordCount;
+		memory->dataWidth = dataWidth;
+		memory->wordBytes = dataWidth <= 8 ? 1 : dataWidth <= 16 ? 2 : 4;
+		memory->dataMask = dataWidth == 32 ? UINT32_MAX : (1u << dataWidth) - 1;
+
+		size_t byteCount = static_cast<size_t>(wordCount) * memory->wordBytes;
+		size_t pageCount = (byteCount + MEMORY_PAGE_SIZE - 1) / MEMORY_PAGE_SIZE;
+
+		//only the page table is allocated up front
+		memory->pages.assign(pageCount, nullptr);
+		memory->ownedPages.resize(pageCount);
+
+		return memory;
+	}
+
+	unique_ptr<Memory> Memory::CreateRom(
+		const string& name,
+		const string& imagePath,
+		uint32_t dataWidth)
+	{
+		if (!IsValidDataWidth(name, dataWidth)) return nullptr;
+
+		unique_ptr<MappedFile> image = MappedFile::Open(imagePath);
+		if (image == nullptr) return nullptr;
+
+		uint32_t wordBytes = dataWidth <= 8 ? 1 : dataWidth <= 16 ? 2 : 4;
+		size_t imageSize = image->GetSize();
+
+		if (imageSize == 0
+			|| imageSize / wordBytes > UINT32_MAX)
+		{
+			Logger::Print(
+				"Cannot create ROM '" + name + "' because image '" + imagePath + "' is empty or too large!",
+				"MEMORY",
+				LogType::LOG_ERROR,
+				2);
+
+			return nullptr;
+		}
+
+		//a trailing partial word is padded with zeroes
+		uint32_t wordCount = static_cast<uint32_t>((imageSize + wordBytes - 1) / wordBytes);
+
+		unique_ptr<Memory> memory = Allocate(name, wordCount, dataWidth);
+
+		//full pages read straight out of the mapping, nothing is copied or decoded
+		size_t pageCount = memory->pages.size();
+		size_t fullPages = imageSize / MEMORY_PAGE_SIZE;
+		for (size_t i = 0; i < fullPages; i++)
+		{
+			memory->pages[i] = image->GetData() + i * MEMORY_PAGE_SIZE;
+		}
+
+		//the tail page is copied so reads never run past the end of the file
+		if (fullPages < pageCount)
+		{
+			uint8_t* page = memory->GetWritablePage(fullPages);
+			memcpy(
+				page,
+				image->GetData() + fullPages * MEMORY_PAGE_SIZE,
+				imageSize - fullPages * MEMORY_PAGE_SIZE);
+		}
+
+		memory->image = move(image);
+		memory->isReadOnly = true;
+
+		Logger::Print(
+			"Mapped ROM '" + name + "' from '" + imagePath + "' with '" + to_string(wordCount) + "' words.",
+			"MEMORY",
+			LogType::LOG_SUCCESS);
+
+		return memory;
+	}
+
+	void Memory::Write(uint32_t address, uint32_t value)
+	{
+		if (isReadOnly
+			|| address >= wordCount)
+		{
+			return;
+		}
+
+		size_t byte = static_cast<size_t>(address) * wordBytes;
+		uint8_t* word = GetWritablePage(byte / MEMORY_PAGE_SIZE) + byte % MEMORY_PAGE_SIZE;
+
+		value &= dataMask;
+		for (uint32_t i = 0; i < wordBytes; i++)
+		{
+			word[i] = static_cast<uint8_t>(value >> (i * 8));
+		}
+	}
+
+	bool Memory::Load(
+		const uint8_t* data,
+		size_t size,
+		uint32_t offset)
+	{
+		if (isReadOnly)
+		{
+			Logger::Print(
+				"Cannot load data into ROM '" + name + "'!",
+				"MEMORY",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		size_t byteCount = static_cast<size_t>(wordCount) * wordBytes;
+		size_t start = static_cast<size_t>(offset) * wordBytes;
+
+		if (start > byteCount
+			|| size > byteCount - start)
+		{
+			Logger::Print(
+				"Cannot load '" + to_string(size) + "' bytes into memory '" + name + "' at word '"
+				+ to_string(offset) + "' because it does not fit!",
+				"MEMORY",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		size_t copied = 0;
+		while (copied < size)
+		{
+			size_t byte = start + copied;
+			size_t pageIndex = byte / MEMORY_PAGE_SIZE;
+			size_t pageOffset = byte % MEMORY_PAGE_SIZE;
+			size_t chunk = min(MEMORY_PAGE_SIZE - pageOffset, size - copied);
+
+			const uint8_t* source = data + copied;
+			bool isZero = all_of(
+				source,
+				source + chunk,
+				[](uint8_t b) { return b == 0; });
+
+			//unallocated pages already read as zero
+			if (!isZero
+				|| pages[pageIndex] != nullptr)
+			{
+				memcpy(GetWritablePage(pageIndex) + pageOffset, source, chunk);
+			}
+
+			copied += chunk;
+		}
+
+		return true;
+	}
+
+	bool Memory::LoadImage(
+		const string& imagePath,
+		uint32_t offset)
+	{
+		unique_ptr<MappedFile> file = MappedFile::Open(imagePath);
+		if (file == nullptr) return false;
+
+		if (file->GetSize() == 0) return true;
+
+		return Load(file->GetData(), file->GetSize(), offset);
+	}
+
+	uint8_t* Memory::GetWritablePage(size_t pageIndex)
+	{
+		if (ownedPages[pageIndex] == nullptr)
+		{
+			//value-initialized, so a fresh page reads as zero
+			ownedPages[pageIndex] = make_unique<uint8_t[]>(MEMORY_PAGE_SIZE);
+
+			//copy-on-write over a mapped page
+			if (pages[pageIndex] != nullptr)
+			{
+				memcpy(ownedPages[pageIndex].get(), pages[pageIndex], MEMORY_PAGE_SIZE);
+			}
+
+			pages[pageIndex] = ownedPages[pageIndex].get();
+			allocatedPageCount++;
+		}
+
+		return ownedPages[pageIndex].get();
+	}
+}
+
+bool IsValidDataWidth(
+	const string& name,
+	uint32_t dataWidth)
+{
+	if (dataWidth == 0
+		|| dataWidth > 32)
+	{
+		Logger::Print(
+			"Cannot create memory '" + name + "' with a data width of '" + to_string(dataWidth) + "' bits, it must be 1 to 32!",
+			"MEMORY",
+			LogType::LOG_ERROR,
+			2);
+
+		return false;
+	}
+
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,111 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <vector>
+
+#include "simulation/probe.hpp"
+
+using CircuitGame::Simulation::Probe;
+using CircuitGame::Simulation::ProbeLevel;
+
+using std::max;
+using std::min;
+using std::vector;
+using std::memory_order_relaxed;
+
+//Enough room for several frames of words at a few MHz of samples
+static constexpr size_t RING_WORDS = 4096;
+
+namespace CircuitGame::Simulation
+{
+	Probe::Probe(uint32_t net, size_t historySamples) :
+		net(net),
+		ring(RING_WORDS)
+	{
+		size_t historyWords = max<size_t>(1, (historySamples + 63) / 64);
+		history.resize(historyWords);
+	}
+
+	void Probe::Flush()
+	{
+		if (!ring.TryPush(pendingWord))
+		{
+			droppedWords.fetch_add(1, memory_order_relaxed);
+		}
+
+		pendingWord = 0;
+		pendingBits = 0;
+	}
+
+	bool Probe::Drain()
+	{
+		size_t capacity = history.size();
+
+		size_t count = ring.PopAll([&](uint64_t word)
+			{
+				if (historyCount < capacity)
+				{
+					history[(historyStart + historyCount) % capacity] = word;
+					historyCount++;
+				}
+				else
+				{
+					//overwrite the oldest word
+					history[historyStart] = word;
+					historyStart = (historyStart + 1) % capacity;
+				}
+			});
+
+		return count > 0;
+	}
+
+	void Probe::Decimate(
+		size_t pixelWidth,
+		vector<ProbeLevel>& out) const
+	{
+		out.assign(pixelWidth, ProbeLevel::low);
+
+		size_t sampleCount = historyCount * 64;
+		if (pixelWidth == 0
+			|| sampleCount == 0)
+		{
+			return;
+		}
+
+		size_t capacity = history.size();
+
+		for (size_t column = 0; column < pixelWidth; column++)
+		{
+			size_t begin = column * sampleCount / pixelWidth;
+			size_t end = max(begin + 1, (column + 1) * sampleCount / pixelWidth);
+
+			bool anyHigh = false;
+			bool allHigh = true;
+
+			//scan whole words at a time instead of single samples
+			while (begin < end)
+			{
+				size_t offset = begin & 63;
+				size_t bitCount = min<size_t>(64 - offset, end - begin);
+
+				uint64_t mask = bitCount == 64
+					? ~0ULL
+					: ((1ULL << bitCount) - 1) << offset;
+
+				uint64_t word = history[(historyStart + begin / 64) % capacity];
+				uint64_t bits = word & mask;
+
+				anyHigh = anyHigh || bits != 0;
+				allHigh = allHigh && bits == mask;
+
+				begin += bitCount;
+			}
+
+			if (allHigh) out[column] = ProbeLevel::high;
+			else if (anyHigh) out[column] = ProbeLevel::toggling;
+		}
+	}
+}
\ No newline at end of file
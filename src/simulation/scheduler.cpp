@@ -0,0 +1,50 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <vector>
+
+#include "simulation/scheduler.hpp"
+
+using CircuitGame::Simulation::ClockScheduler;
+using CircuitGame::Simulation::ClockSource;
+
+using std::vector;
+
+namespace CircuitGame::Simulation
+{
+	void ClockScheduler::Reset(
+		const vector<ClockSource>& newClocks,
+		uint64_t startTime)
+	{
+		clocks = newClocks;
+		edges = {};
+
+		for (uint32_t i = 0; i < clocks.size(); i++)
+		{
+			edges.push({ startTime + clocks[i].phase, i });
+		}
+	}
+
+	uint64_t ClockScheduler::PopDueEdges(vector<uint32_t>& dueNets)
+	{
+		if (edges.empty()) return NO_EDGE;
+
+		uint64_t time = edges.top().time;
+
+		while (!edges.empty()
+			&& edges.top().time == time)
+		{
+			Edge edge = edges.top();
+			edges.pop();
+
+			const ClockSource& clock = clocks[edge.clock];
+			dueNets.push_back(clock.net);
+
+			edges.push({ time + clock.halfPeriod, edge.clock });
+		}
+
+		return time;
+	}
+}
\ No newline at end of file
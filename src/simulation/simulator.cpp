@@ -0,0 +1,381 @@
+//Copyright(C) 2025 Lost Empire Entertainment
+//This program comes with ABSOLUTELY NO WARRANTY.
+//This is free software, and you are welcome to redistribute it under certain conditions.
+//Read LICENSE.md for more information.
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+//kalawindow
+#include "core/log.hpp"
+
+#include "simulation/simulator.hpp"
+#include "core/trace.hpp"
+
+//kalawindow
+using KalaWindow::Core::Logger;
+using KalaWindow::Core::LogType;
+
+using CircuitGame::Simulation::Simulator;
+using CircuitGame::Simulation::Probe;
+
+using std::chrono::steady_clock;
+using std::chrono::duration;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::duration_cast;
+using std::this_thread::sleep_for;
+using std::make_unique;
+using std::max;
+using std::min;
+using std::remove_if;
+using std::string;
+using std::to_string;
+using std::vector;
+using std::memory_order_relaxed;
+
+//Upper bound of time points between two checks of the stop flag
+static constexpr uint64_t MAX_BATCH_STEPS = 65536;
+
+//How many samples every probe keeps for the overlay
+static constexpr size_t PROBE_HISTORY_SAMPLES = 1 << 16;
+
+namespace CircuitGame::Simulation
+{
+	bool Simulator::Initialize()
+	{
+		simulatedTime = 0;
+		stepCount = 0;
+
+		if (!board.Compile()) return false;
+		scheduler.Reset(board.GetClocks(), 0);
+
+		//the first frame shows the initial states even before any clock edge
+		PublishNetStates();
+
+		Start();
+
+		Logger::Print(
+			"Initialized simulation with '" + to_string(board.GetClocks().size()) + "' clock domains!",
+			"SIMULATION",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+
+	void Simulator::SetTimeScale(double newTimeScale)
+	{
+		if (newTimeScale <= 0.0)
+		{
+			Logger::Print(
+				"Cannot set simulation time scale to zero or less!",
+				"SIMULATION",
+				LogType::LOG_ERROR,
+				2);
+
+			return;
+		}
+
+		bool wasRunning = IsRunning();
+		Stop();
+
+		timeScale = newTimeScale;
+
+		if (wasRunning) Start();
+	}
+
+	void Simulator::Start()
+	{
+		if (IsRunning()) return;
+
+		//edited boards restart their clocks from the current simulated time
+		if (!board.IsCompiled())
+		{
+			if (!board.Compile()) return;
+			scheduler.Reset(board.GetClocks(), GetSimulatedTime());
+
+			PublishNetStates();
+		}
+
+		UpdateProbeSampling();
+
+		isRunning = true;
+		simulationThread = thread(Run);
+	}
+
+	void Simulator::Stop()
+	{
+		if (!IsRunning()) return;
+
+		isRunning = false;
+		if (simulationThread.joinable()) simulationThread.join();
+	}
+
+	Probe* Simulator::AttachProbe(uint32_t net)
+	{
+		if (net >= board.GetNetCount())
+		{
+			Logger::Print(
+				"Cannot attach probe to net '" + to_string(net) + "' because it does not exist!",
+				"SIMULATION",
+				LogType::LOG_ERROR,
+				2);
+
+			return nullptr;
+		}
+
+		bool wasRunning = IsRunning();
+		Stop();
+
+		probes.push_back(make_unique<Probe>(net, PROBE_HISTORY_SAMPLES));
+		Probe* probe = probes.back().get();
+
+		if (wasRunning) Start();
+
+		return probe;
+	}
+
+	void Simulator::DetachProbe(Probe* probe)
+	{
+		bool wasRunning = IsRunning();
+		Stop();
+
+		probes.erase(
+			remove_if(
+				probes.begin(),
+				probes.end(),
+				[probe](const auto& p) { return p.get() == probe; }),
+			probes.end());
+
+		if (wasRunning) Start();
+	}
+
+	bool Simulator::DrainProbes()
+	{
+		bool hasSamples = false;
+		for (const auto& probe : probes)
+		{
+			hasSamples |= probe->Drain();
+		}
+
+		return hasSamples;
+	}
+
+	void Simulator::UpdateProbeSampling()
+	{
+		drainInterval = nanoseconds::max();
+
+		uint64_t shortestHalfPeriod = UINT64_MAX;
+		for (const ClockSource& clock : board.GetClocks())
+		{
+			shortestHalfPeriod = min(shortestHalfPeriod, clock.halfPeriod);
+		}
+
+		//without clocks no time point is ever reached and nothing is sampled
+		if (shortestHalfPeriod == UINT64_MAX) return;
+
+		probeSamplePeriod = max<uint64_t>(1, shortestHalfPeriod / 2);
+
+		if (probes.empty()) return;
+
+		double samplesPerSecond = 1e12 / static_cast<double>(probeSamplePeriod) * timeScale;
+
+		uint64_t ringSamples = UINT64_MAX;
+		for (const auto& probe : probes)
+		{
+			ringSamples = min(ringSamples, probe->GetRingSamples());
+		}
+
+		double seconds = static_cast<double>(ringSamples) / samplesPerSecond;
+		if (seconds < duration<double>(nanoseconds::max()).count())
+		{
+			drainInterval = duration_cast<nanoseconds>(duration<double>(seconds));
+		}
+	}
+
+	bool Simulator::RunBenchmark(double seconds)
+	{
+		Stop();
+
+		simulatedTime = 0;
+		stepCount = 0;
+
+		auto compileStart = steady_clock::now();
+		if (!board.Compile()) return false;
+		duration<double> compileTime = steady_clock::now() - compileStart;
+
+		scheduler.Reset(board.GetClocks(), 0);
+
+		if (scheduler.GetNextEdgeTime() == NO_EDGE)
+		{
+			Logger::Print(
+				"Cannot benchmark a board without clocks!",
+				"SIMULATION",
+				LogType::LOG_ERROR,
+				2);
+
+			return false;
+		}
+
+		vector<uint32_t> dueNets{};
+		uint64_t firstEvaluation = board.GetEvaluationCount();
+		uint64_t steps = 0;
+		uint64_t time = 0;
+
+		auto start = steady_clock::now();
+		duration<double> elapsed{};
+
+		while (elapsed.count() < seconds)
+		{
+			//same loop as Run without the pacing, the clock is only read once per batch
+			for (uint32_t i = 0; i < 1024; i++)
+			{
+				dueNets.clear();
+				time = scheduler.PopDueEdges(dueNets);
+
+				for (uint32_t net : dueNets)
+				{
+					board.SetNetState(net, !board.GetNetState(net));
+				}
+
+				board.Step();
+			}
+
+			steps += 1024;
+			elapsed = steady_clock::now() - start;
+		}
+
+		simulatedTime = time;
+		stepCount = steps;
+
+		double wallTime = elapsed.count();
+		uint64_t evaluations = board.GetEvaluationCount() - firstEvaluation;
+
+		Logger::Print(
+			"Benchmarked '" + to_string(board.GetGateCount()) + "' gates for '" + to_string(wallTime) + "' seconds:\n"
+			+ "  compile time:           " + to_string(compileTime.count()) + " s\n"
+			+ "  steps per second:       " + to_string(steps / wallTime) + "\n"
+			+ "  evaluations per second: " + to_string(evaluations / wallTime) + "\n"
+			+ "  simulated time:         " + to_string(time * 1e-12) + " s\n"
+			+ "  isolated gates:         " + to_string(board.GetIsolatedGateCount()),
+			"SIMULATION",
+			LogType::LOG_SUCCESS);
+
+		return true;
+	}
+
+	void Simulator::Shutdown()
+	{
+		Stop();
+
+		probes.clear();
+	}
+
+	void Simulator::Run()
+	{
+		TRACE_THREAD_NAME("simulation");
+
+		//the probe list only changes while this thread is stopped
+		vector<Probe*> activeProbes{};
+		for (const auto& probe : probes) activeProbes.push_back(probe.get());
+
+		vector<uint32_t> dueNets{};
+
+		uint64_t samplePeriod = probeSamplePeriod;
+
+		//simulated time is paced against the wall clock from this anchor
+		auto anchorReal = steady_clock::now();
+		uint64_t anchorTime = GetSimulatedTime();
+		uint64_t time = anchorTime;
+
+		//first point of the sample grid not sampled yet
+		uint64_t nextSampleTime = (time + samplePeriod - 1) / samplePeriod * samplePeriod;
+
+		while (isRunning.load(memory_order_relaxed))
+		{
+			duration<double> elapsed = steady_clock::now() - anchorReal;
+			uint64_t dueTime = anchorTime + static_cast<uint64_t>(elapsed.count() * timeScale * 1e12);
+
+			if (scheduler.GetNextEdgeTime() > dueTime)
+			{
+				time = min(dueTime, scheduler.GetNextEdgeTime());
+				simulatedTime.store(time, memory_order_relaxed);
+
+				sleep_for(milliseconds(1));
+				continue;
+			}
+
+			//more than a second of simulated time behind, run slower than real time
+			//instead of skipping edges or never catching up
+			if (dueTime - time > static_cast<uint64_t>(timeScale * 1e12))
+			{
+				anchorReal = steady_clock::now();
+				anchorTime = time;
+			}
+
+			TRACE_ZONE("Simulator::Batch");
+
+			uint64_t batch = 0;
+			while (batch < MAX_BATCH_STEPS
+				&& scheduler.GetNextEdgeTime() <= dueTime)
+			{
+				//the levels settled at the previous time point held for every grid point before this one,
+				//a grid point on the edge itself is sampled after the edge
+				uint64_t edgeTime = scheduler.GetNextEdgeTime();
+				if (edgeTime > nextSampleTime
+					&& !activeProbes.empty())
+				{
+					uint64_t sampleCount = (edgeTime - nextSampleTime + samplePeriod - 1) / samplePeriod;
+					nextSampleTime += sampleCount * samplePeriod;
+
+					for (Probe* probe : activeProbes)
+					{
+						probe->Sample(board.GetNetState(probe->GetNet()), sampleCount);
+					}
+				}
+
+				//only the domains due at this time point toggle,
+				//the board then evaluates nothing but their fanout
+				dueNets.clear();
+				time = scheduler.PopDueEdges(dueNets);
+
+				for (uint32_t net : dueNets)
+				{
+					board.SetNetState(net, !board.GetNetState(net));
+				}
+
+				board.Step();
+
+				batch++;
+			}
+
+			simulatedTime.store(time, memory_order_relaxed);
+			stepCount.fetch_add(batch, memory_order_relaxed);
+			TRACE_COUNTER("steps per batch", batch);
+
+			//once per batch, the render thread only ever takes the newest snapshot
+			PublishNetStates();
+		}
+	}
+
+	const vector<uint32_t>* Simulator::TakeNetStates()
+	{
+		if (!netStates.Take()) return nullptr;
+		return &netStates.GetFront();
+	}
+
+	void Simulator::PublishNetStates()
+	{
+		TRACE_ZONE("Simulator::PublishNetStates");
+
+		board.PackNetStates(netStates.GetBack());
+		netStates.Publish();
+
+		isolatedGateCount.store(board.GetIsolatedGateCount(), memory_order_relaxed);
+		oscillatingNetCount.store(static_cast<uint32_t>(board.GetOscillatingNets().size()), memory_order_relaxed);
+	}
+}
\ No newline at end of file